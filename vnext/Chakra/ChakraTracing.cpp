@@ -276,6 +276,10 @@ static JsValueRef __stdcall nativeTraceCounterJNF(
 
 } // end anonymous namespace
 
+bool IsTracingEnabled() noexcept {
+  return g_nativeTracingHook != nullptr;
+}
+
 void SystraceBeginSection(const char *name, const char *args) noexcept {
   if (g_nativeTracingHook) {
     g_nativeTracingHook->NativeBeginSection(name, args);
@@ -288,6 +292,22 @@ void SystraceEndSection(const char *name, const char *args, std::chrono::nanosec
   }
 }
 
+void SystraceBeginAsyncSection(const char *name, int cookie, const char *args) noexcept {
+  if (g_nativeTracingHook) {
+    g_nativeTracingHook->NativeBeginAsyncSection(name, cookie, args);
+  }
+}
+
+void SystraceEndAsyncSection(
+    const char *name,
+    int cookie,
+    const char *args,
+    std::chrono::nanoseconds duration) noexcept {
+  if (g_nativeTracingHook) {
+    g_nativeTracingHook->NativeEndAsyncSection(name, cookie, args, duration);
+  }
+}
+
 #ifdef ENABLE_JS_SYSTRACE
 
 void addNativeTracingHooks() {
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <Animated/AnimationCurves.h>
+#include <CppUnitTest.h>
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <string>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+SpringParameters Spring(double stiffness, double damping, double endValue = 100.0) {
+  SpringParameters spring;
+  spring.stiffness = stiffness;
+  spring.damping = damping;
+  spring.mass = 1.0;
+  spring.startValue = 0.0;
+  spring.endValue = endValue;
+  return spring;
+}
+
+// Rest thresholds used by Animated.spring.
+constexpr double c_restSpeedThreshold = 0.001;
+constexpr double c_restDisplacementThreshold = 0.001;
+
+bool SpringAtRest(const SpringParameters &spring, double value, double velocity) {
+  return std::abs(velocity) <= c_restSpeedThreshold && std::abs(value - spring.endValue) <= c_restDisplacementThreshold;
+}
+
+std::vector<Keyframe> SpringKeyframes(const SpringParameters &spring, const KeyframeSamplingOptions &options) {
+  return GenerateKeyframes(
+      [&spring](double time) { return SpringValueAndVelocity(spring, spring.endValue, time); },
+      [&spring](double value, double velocity) { return SpringAtRest(spring, value, velocity); },
+      EstimateSpringSettleTime(spring, c_restSpeedThreshold, c_restDisplacementThreshold),
+      options);
+}
+
+std::vector<Keyframe> DecayKeyframes(double velocity, double deceleration, const KeyframeSamplingOptions &options) {
+  const double endValue = velocity / (1 - deceleration);
+  return GenerateKeyframes(
+      [=](double time) {
+        return std::make_tuple(static_cast<float>(DecayValue(0.0, velocity, deceleration, time)), 0.0);
+      },
+      [=](double value, double) { return std::abs(endValue - value) < 0.1; },
+      EstimateDecaySettleTime(velocity, deceleration, 0.1),
+      options);
+}
+
+// Largest distance between the keyframe curve and the curve sampled per frame.
+double MaxError(const std::vector<Keyframe> &keyframes, const std::function<double(double)> &curve) {
+  double maxError = 0.0;
+  size_t segment = 1;
+  for (double time = 0.0; time <= keyframes.back().time; time += 1.0 / 60.0) {
+    while (segment < keyframes.size() - 1 && keyframes[segment].time < time)
+      ++segment;
+    const auto &from = keyframes[segment - 1];
+    const auto &to = keyframes[segment];
+    const double value = from.value + (to.value - from.value) * (time - from.time) / (to.time - from.time);
+    maxError = std::max(maxError, std::abs(value - curve(time)));
+  }
+  return maxError;
+}
+
+} // namespace
+
+TEST_CLASS(AnimationCurvesTests) {
+  TEST_METHOD(AnimationCurvesTests_SimplifyKeepsLinearRunsAsOneSegment) {
+    std::vector<Keyframe> samples;
+    for (int i = 0; i <= 10; ++i)
+      samples.push_back({i / 10.0, static_cast<double>(i)});
+    for (int i = 11; i <= 20; ++i)
+      samples.push_back({i / 10.0, 10.0});
+
+    auto keyframes = SimplifyKeyframes(samples, 0.01);
+    Assert::AreEqual(size_t{3}, keyframes.size());
+    Assert::AreEqual(1.0, keyframes[1].time);
+    Assert::AreEqual(2.0, keyframes[2].time);
+  }
+
+  TEST_METHOD(AnimationCurvesTests_SpringKeyframesStayWithinTolerance) {
+    const auto spring = Spring(100, 10);
+    KeyframeSamplingOptions options;
+    options.relativeTolerance = 0.001;
+    auto keyframes = SpringKeyframes(spring, options);
+
+    const double settleTime = EstimateSpringSettleTime(spring, c_restSpeedThreshold, c_restDisplacementThreshold);
+    Assert::IsTrue(keyframes.back().time <= settleTime + options.frameInterval);
+    Assert::IsTrue(std::abs(keyframes.back().value - spring.endValue) <= c_restDisplacementThreshold);
+
+    // The range of a spring includes its overshoot, so the bound is slightly
+    // above 0.1% of the distance.
+    double error = MaxError(keyframes, [&spring](double time) {
+      return std::get<0>(SpringValueAndVelocity(spring, spring.endValue, time));
+    });
+    Assert::IsTrue(error <= 0.2);
+    Assert::IsTrue(keyframes.size() < static_cast<size_t>(keyframes.back().time * 60) / 2);
+  }
+
+  TEST_METHOD(AnimationCurvesTests_DecaySettleTimeMatchesRestCondition) {
+    const double velocity = 2.0;
+    const double deceleration = 0.997;
+    const double settleTime = EstimateDecaySettleTime(velocity, deceleration, 0.1);
+    const double endValue = velocity / (1 - deceleration);
+    Assert::AreEqual(0.1, endValue - DecayValue(0.0, velocity, deceleration, settleTime), 1e-9);
+
+    auto keyframes = DecayKeyframes(velocity, deceleration, {});
+    Assert::IsTrue(std::abs(endValue - keyframes.back().value) < 0.1);
+  }
+
+  TEST_METHOD(AnimationCurvesTests_UndampedSpringIsCapped) {
+    const auto spring = Spring(100, 0);
+    Assert::IsTrue(std::isinf(EstimateSpringSettleTime(spring, c_restSpeedThreshold, c_restDisplacementThreshold)));
+
+    KeyframeSamplingOptions options;
+    options.maxDuration = 5.0;
+    options.maxKeyframes = 40;
+    auto keyframes = SpringKeyframes(spring, options);
+    Assert::IsTrue(keyframes.size() <= 40);
+    Assert::AreEqual(5.0, keyframes.back().time, 1.0 / 60.0);
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(AnimationCurvesTests_Benchmark)
+  TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(AnimationCurvesTests_Benchmark) {
+    struct Case {
+      const wchar_t *name;
+      std::function<std::vector<Keyframe>(const KeyframeSamplingOptions &)> generate;
+    };
+    const Case cases[] = {
+        {L"spring stiff", [](const auto &options) { return SpringKeyframes(Spring(400, 40), options); }},
+        {L"spring default", [](const auto &options) { return SpringKeyframes(Spring(100, 10), options); }},
+        {L"spring bouncy", [](const auto &options) { return SpringKeyframes(Spring(40, 2), options); }},
+        {L"spring overdamped", [](const auto &options) { return SpringKeyframes(Spring(100, 40), options); }},
+        {L"decay fast", [](const auto &options) { return DecayKeyframes(5.0, 0.997, options); }},
+        {L"decay slow", [](const auto &options) { return DecayKeyframes(0.5, 0.999, options); }},
+    };
+
+    // A tolerance of zero keeps every sample that does not lie on a straight
+    // run, which is about what the fixed-step sampling emitted.
+    KeyframeSamplingOptions dense;
+    dense.relativeTolerance = 0.0;
+    dense.absoluteTolerance = 0.0;
+    dense.maxKeyframes = std::numeric_limits<size_t>::max();
+    constexpr int iterations = 200;
+
+    for (const auto &testCase : cases) {
+      size_t keyframes = 0, denseKeyframes = testCase.generate(dense).size();
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i)
+        keyframes = testCase.generate({}).size();
+      auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+      Assert::IsTrue(keyframes <= denseKeyframes);
+      Logger::WriteMessage((std::wstring(testCase.name) + L": " + std::to_wstring(keyframes) + L" keyframes (" +
+                            std::to_wstring(denseKeyframes) + L" per frame), " +
+                            std::to_wstring(elapsed / iterations) + L" us\n")
+                               .c_str());
+    }
+  }
+};
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <Animated/AnimationStats.h>
+#include <CppUnitTest.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono_literals;
+
+TEST_CLASS(AnimationStatsTests) {
+  TEST_METHOD(AnimationStatsTests_HistogramBucketsByPowersOfTwo) {
+    Log2Histogram histogram;
+    histogram.Add(0.5);
+    histogram.Add(1.0);
+    histogram.Add(3.0);
+    histogram.Add(3.9);
+    histogram.Add(1e9);
+
+    Assert::AreEqual(uint64_t{1}, histogram.buckets[0]);
+    Assert::AreEqual(uint64_t{1}, histogram.buckets[1]);
+    Assert::AreEqual(uint64_t{2}, histogram.buckets[2]);
+    Assert::AreEqual(uint64_t{1}, histogram.buckets[Log2Histogram::c_bucketCount - 1]);
+    Assert::AreEqual(uint64_t{5}, histogram.count);
+    Assert::AreEqual(1e9, histogram.max);
+  }
+
+  TEST_METHOD(AnimationStatsTests_PercentileIsBucketUpperBound) {
+    Log2Histogram histogram;
+    Assert::AreEqual(0.0, histogram.Percentile(0.5));
+
+    for (int i = 0; i < 90; ++i)
+      histogram.Add(10.0);
+    for (int i = 0; i < 10; ++i)
+      histogram.Add(100.0);
+
+    Assert::AreEqual(16.0, histogram.Percentile(0.5));
+    Assert::AreEqual(16.0, histogram.Percentile(0.9));
+    Assert::AreEqual(100.0, histogram.Percentile(0.99));
+    Assert::AreEqual(100.0, histogram.Percentile(1.0));
+    Assert::AreEqual(19.0, histogram.Mean());
+  }
+
+  TEST_METHOD(AnimationStatsTests_CountsFramesPastExpectedEnd) {
+    const auto frame = std::chrono::nanoseconds(16'666'667);
+    Assert::AreEqual(uint64_t{0}, CountDroppedFrames(500ms, 500ms, frame));
+    Assert::AreEqual(uint64_t{0}, CountDroppedFrames(510ms, 500ms, frame));
+    Assert::AreEqual(uint64_t{2}, CountDroppedFrames(540ms, 500ms, frame));
+    Assert::AreEqual(uint64_t{0}, CountDroppedFrames(400ms, 500ms, frame));
+    Assert::AreEqual(uint64_t{0}, CountDroppedFrames(540ms, 500ms, 0ns));
+  }
+
+  TEST_METHOD(AnimationStatsTests_AggregatesAnimations) {
+    AnimationStats stats;
+    stats.RecordStart(2ms, 12);
+    stats.RecordStart(40ms, 3);
+    stats.RecordFinish(300ms, 0);
+    stats.RecordFinish(520ms, 3);
+    stats.RecordStop();
+
+    auto snapshot = stats.GetSnapshot();
+    Assert::AreEqual(uint64_t{2}, snapshot.started);
+    Assert::AreEqual(uint64_t{2}, snapshot.finished);
+    Assert::AreEqual(uint64_t{1}, snapshot.stopped);
+    Assert::AreEqual(uint64_t{3}, snapshot.droppedFrames);
+    Assert::AreEqual(40.0, snapshot.startLatencyMs.max);
+    Assert::AreEqual(7.5, snapshot.keyframes.Mean());
+    Assert::AreEqual(uint64_t{2}, snapshot.durationMs.count);
+
+    stats.Reset();
+    snapshot = stats.GetSnapshot();
+    Assert::AreEqual(uint64_t{0}, snapshot.started);
+    Assert::AreEqual(uint64_t{0}, snapshot.startLatencyMs.count);
+  }
+};
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <BatchBuffers.h>
+#include <CppUnitTest.h>
+#include <PriorityMessageQueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+using RecycledLanes = TaskLanes<std::string, RecycledLane<std::string>>;
+
+using WorkItemQueue = TaskLanes<std::function<void()>, RecycledLane<std::function<void()>>>;
+
+// The UI side of the handoff: one thread that runs the posted batches.
+class BatchRunner {
+ public:
+  BatchRunner() : m_thread{[this] { Run(); }} {}
+
+  ~BatchRunner() {
+    Post(nullptr);
+    m_thread.join();
+  }
+
+  // A null func stops the runner.
+  void Post(std::function<void()> &&func) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_funcs.push_back(std::move(func));
+    }
+    m_posted.notify_one();
+  }
+
+ private:
+  void Run() {
+    for (;;) {
+      std::function<void()> func;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_posted.wait(lock, [this] { return !m_funcs.empty(); });
+        func = std::move(m_funcs.front());
+        m_funcs.pop_front();
+      }
+      if (!func)
+        return;
+      func();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_posted;
+  std::deque<std::function<void()>> m_funcs;
+  std::thread m_thread;
+};
+
+// Posts batchCount batches of tasksPerBatch tasks the way the batching
+// queue threads do; takeBatch hands out the filled queue for each batch.
+// Returns the average time per batch in nanoseconds.
+template <typename TQueue, typename TCurrent, typename TTakeBatch>
+double PostBatches(size_t batchCount, size_t tasksPerBatch, TCurrent current, TTakeBatch takeBatch) {
+  BatchRunner runner;
+  std::atomic<size_t> ran{0};
+  const size_t total = batchCount * tasksPerBatch;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t batch = 0; batch < batchCount; ++batch) {
+    for (size_t i = 0; i < tasksPerBatch; ++i)
+      current().Push(TaskPriority::Normal, [&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+
+    std::shared_ptr<TQueue> queue = takeBatch();
+    runner.Post([queue{std::move(queue)}]() {
+      while (!queue->IsEmpty())
+        queue->Pop()();
+    });
+  }
+  while (ran.load(std::memory_order_relaxed) < total)
+    std::this_thread::yield();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  return std::chrono::duration<double, std::nano>(elapsed).count() / batchCount;
+}
+
+} // namespace
+
+TEST_CLASS(BatchBuffersTests) {
+  TEST_METHOD(BatchBuffersTests_RecycledLanesKeepOrder) {
+    RecycledLanes lanes;
+    for (int round = 0; round < 2; ++round) {
+      lanes.Push(TaskPriority::Background, "b");
+      lanes.Push(TaskPriority::Normal, "n1");
+      lanes.Push(TaskPriority::UserBlocking, "u");
+      lanes.Push(TaskPriority::Normal, "n2");
+
+      std::string order;
+      while (!lanes.IsEmpty())
+        order += lanes.Pop();
+      Assert::AreEqual(std::string("un1n2b"), order);
+      Assert::AreEqual(size_t{0}, lanes.Size(TaskPriority::Normal));
+    }
+  }
+
+  TEST_METHOD(BatchBuffersTests_ReusesReleasedBuffers) {
+    BatchBuffers<RecycledLanes> buffers;
+    Assert::IsFalse(buffers.HasBatch());
+    Assert::IsTrue(buffers.TakeBatch() == nullptr);
+
+    buffers.Current().Push(TaskPriority::Normal, "a");
+    Assert::IsTrue(buffers.HasBatch());
+    auto first = buffers.TakeBatch();
+    buffers.Current().Push(TaskPriority::Normal, "b");
+    auto second = buffers.TakeBatch();
+    Assert::IsTrue(first != second);
+
+    // The batches ran and were released, so the same two buffers come back.
+    const RecycledLanes *firstBuffer = first.get();
+    const RecycledLanes *secondBuffer = second.get();
+    first->Pop();
+    second->Pop();
+    first.reset();
+    second.reset();
+
+    Assert::IsTrue(&buffers.Current() == firstBuffer);
+    buffers.TakeBatch();
+    Assert::IsTrue(&buffers.Current() == secondBuffer);
+  }
+
+  TEST_METHOD(BatchBuffersTests_ReplacesBuffersInUse) {
+    BatchBuffers<RecycledLanes> buffers;
+    buffers.Current().Push(TaskPriority::Normal, "a");
+    auto inFlight = buffers.TakeBatch();
+    buffers.Current().Push(TaskPriority::Normal, "b");
+    auto dropped = buffers.TakeBatch();
+    dropped.reset();
+
+    // Still running: a new buffer takes its place.
+    Assert::IsTrue(&buffers.Current() != inFlight.get());
+    Assert::IsTrue(buffers.Current().IsEmpty());
+    buffers.TakeBatch();
+
+    // Released without running its task: the task is not carried over.
+    Assert::IsTrue(buffers.Current().IsEmpty());
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(BatchBuffersTests_BatchHandoffBenchmark)
+  TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(BatchBuffersTests_BatchHandoffBenchmark) {
+    constexpr size_t batchCount = 20000;
+    for (size_t tasksPerBatch : {1, 16, 256}) {
+      // A new queue for each batch, as the batching threads used to do.
+      using AllocatedQueue = TaskLanes<std::function<void()>>;
+      std::shared_ptr<AllocatedQueue> allocatedQueue;
+      const double allocated = PostBatches<AllocatedQueue>(
+          batchCount,
+          tasksPerBatch,
+          [&]() -> AllocatedQueue & {
+            if (!allocatedQueue)
+              allocatedQueue = std::make_shared<AllocatedQueue>();
+            return *allocatedQueue;
+          },
+          [&] { return std::move(allocatedQueue); });
+
+      BatchBuffers<WorkItemQueue> buffers;
+      const double recycled = PostBatches<WorkItemQueue>(
+          batchCount,
+          tasksPerBatch,
+          [&]() -> WorkItemQueue & { return buffers.Current(); },
+          [&] { return buffers.TakeBatch(); });
+
+      Logger::WriteMessage((std::to_wstring(tasksPerBatch) + L" tasks per batch: new queue " +
+                            std::to_wstring(allocated) + L" ns/batch, recycled queues " + std::to_wstring(recycled) +
+                            L" ns/batch\n")
+                               .c_str());
+    }
+  }
+};
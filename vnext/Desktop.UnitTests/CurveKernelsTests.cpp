@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <Animated/CurveKernels.h>
+#include <CppUnitTest.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+SpringParameters Spring(double stiffness, double damping, double mass, double initialVelocity) {
+  SpringParameters spring;
+  spring.stiffness = stiffness;
+  spring.damping = damping;
+  spring.mass = mass;
+  spring.initialVelocity = initialVelocity;
+  spring.startValue = 20.0;
+  spring.endValue = 500.0;
+  return spring;
+}
+
+const SpringParameters c_springs[] = {
+    Spring(100, 10, 1, 0),
+    Spring(40, 2, 1, 300),
+    Spring(1000, 5, 3, -50),
+    Spring(100, 20, 1, 0), // critically damped
+    Spring(100, 60, 1, 10), // overdamped
+};
+
+std::vector<double> FrameTimes(size_t count) {
+  std::vector<double> times(count);
+  for (size_t i = 0; i < count; ++i)
+    times[i] = i / 60.0;
+  return times;
+}
+
+} // namespace
+
+TEST_CLASS(CurveKernelsTests) {
+  TEST_METHOD(CurveKernelsTests_SpringMatchesScalarFormula) {
+    // Odd count, so that the scalar tail is covered too.
+    const auto times = FrameTimes(1801);
+    std::vector<float> values(times.size());
+    std::vector<double> velocities(times.size());
+
+    for (const auto &spring : c_springs) {
+      SpringValuesAndVelocities(spring, times.data(), times.size(), values.data(), velocities.data());
+      for (size_t i = 0; i < times.size(); ++i) {
+        const auto [value, velocity] = SpringValueAndVelocity(spring, spring.endValue, times[i]);
+        Assert::AreEqual(value, values[i], 1e-4f);
+        Assert::AreEqual(velocity, velocities[i], 1e-9 * (1.0 + std::abs(velocity)));
+      }
+    }
+  }
+
+  TEST_METHOD(CurveKernelsTests_DecayMatchesScalarFormula) {
+    const auto times = FrameTimes(603);
+    std::vector<double> values(times.size());
+
+    for (double deceleration : {0.99, 0.997, 0.999}) {
+      DecayValues(10.0, 2.5, deceleration, times.data(), times.size(), values.data());
+      for (size_t i = 0; i < times.size(); ++i)
+        Assert::AreEqual(DecayValue(10.0, 2.5, deceleration, times[i]), values[i], 1e-9);
+    }
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(CurveKernelsTests_Benchmark)
+  TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(CurveKernelsTests_Benchmark) {
+    // 64 springs started in the same frame, 2 s of samples each.
+    constexpr size_t springs = 64;
+    const auto times = FrameTimes(120);
+    std::vector<float> values(times.size());
+    std::vector<double> velocities(times.size());
+    const auto &spring = c_springs[1];
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < springs; ++i) {
+      for (size_t j = 0; j < times.size(); ++j)
+        std::tie(values[j], velocities[j]) = SpringValueAndVelocity(spring, spring.endValue, times[j]);
+    }
+    const auto scalar = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < springs; ++i)
+      SpringValuesAndVelocities(spring, times.data(), times.size(), values.data(), velocities.data());
+    const auto batch = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    const auto samples = static_cast<double>(springs * times.size());
+    std::string instructionSet = CurveKernelInstructionSet();
+    Logger::WriteMessage((L"Spring samples per us: scalar " + std::to_wstring(samples / scalar) + L", " +
+                          std::wstring(instructionSet.begin(), instructionSet.end()) + L" " +
+                          std::to_wstring(samples / batch) + L"\n")
+                             .c_str());
+  }
+};
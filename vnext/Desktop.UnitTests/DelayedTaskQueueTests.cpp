@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <DelayedTaskQueue.h>
+
+#include <memory>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono_literals;
+
+namespace {
+
+DelayedTaskQueue::TimePoint At(std::chrono::milliseconds time) {
+  return DelayedTaskQueue::TimePoint(time);
+}
+
+} // namespace
+
+TEST_CLASS(DelayedTaskQueueTests) {
+  TEST_METHOD(DelayedTaskQueueTests_RunsDueTasksInOrder) {
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    std::vector<int> ran;
+    queue->Post([&ran] { ran.push_back(1); }, At(30ms));
+    queue->Post([&ran] { ran.push_back(2); }, At(10ms));
+    queue->Post([&ran] { ran.push_back(3); }, At(10ms));
+    queue->Post([&ran] { ran.push_back(4); }, At(50ms));
+
+    Assert::IsTrue(queue->NextTime() == At(10ms));
+    queue->RunDue(At(9ms));
+    Assert::IsTrue(ran.empty());
+
+    queue->RunDue(At(30ms));
+    Assert::IsTrue(ran == std::vector<int>{2, 3, 1});
+    Assert::IsTrue(queue->NextTime() == At(50ms));
+
+    queue->RunDue(At(60ms));
+    Assert::IsTrue(ran == std::vector<int>{2, 3, 1, 4});
+    Assert::IsFalse(queue->NextTime().has_value());
+  }
+
+  TEST_METHOD(DelayedTaskQueueTests_CancelReleasesClosure) {
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    auto captured = std::make_shared<int>(0);
+    std::weak_ptr<int> weakCaptured = captured;
+
+    bool ran = false;
+    auto handle = queue->Post([captured = std::move(captured), &ran] { ran = true; }, At(10ms));
+    Assert::IsFalse(weakCaptured.expired());
+
+    Assert::IsTrue(handle.Cancel());
+    Assert::IsTrue(weakCaptured.expired());
+    Assert::IsFalse(handle.Cancel());
+    Assert::IsTrue(queue->IsEmpty());
+
+    queue->RunDue(At(20ms));
+    Assert::IsFalse(ran);
+  }
+
+  TEST_METHOD(DelayedTaskQueueTests_CancelAfterRunFails) {
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    auto handle = queue->Post([] {}, At(10ms));
+    queue->RunDue(At(10ms));
+    Assert::IsFalse(handle.Cancel());
+    Assert::IsFalse(DelayedTaskHandle().Cancel());
+  }
+
+  TEST_METHOD(DelayedTaskQueueTests_HandleOutlivesQueue) {
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    auto handle = queue->Post([] {}, At(10ms));
+    queue.reset();
+    Assert::IsFalse(handle.Cancel());
+  }
+
+  TEST_METHOD(DelayedTaskQueueTests_DebouncedTasksDoNotAccumulate) {
+    // Each keystroke cancels the pending task and posts a new one 100ms out.
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    int runs = 0;
+    DelayedTaskHandle pending;
+    for (int keystroke = 0; keystroke < 1000; ++keystroke) {
+      pending.Cancel();
+      pending = queue->Post([&runs] { ++runs; }, At(keystroke * 10ms + 100ms));
+      queue->RunDue(At(keystroke * 10ms));
+    }
+
+    Assert::AreEqual(size_t{1}, queue->Size());
+    queue->RunDue(At(1000s));
+    Assert::AreEqual(1, runs);
+  }
+
+  TEST_METHOD(DelayedTaskQueueTests_TaskMayCancelAnother) {
+    auto queue = std::make_shared<DelayedTaskQueue>();
+    bool secondRan = false;
+    DelayedTaskHandle second;
+    queue->Post([&second] { Assert::IsTrue(second.Cancel()); }, At(10ms));
+    second = queue->Post([&secondRan] { secondRan = true; }, At(10ms));
+
+    queue->RunDue(At(10ms));
+    Assert::IsFalse(secondRan);
+    Assert::IsTrue(queue->IsEmpty());
+  }
+};
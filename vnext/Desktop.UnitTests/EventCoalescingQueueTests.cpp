@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <EventCoalescingQueue.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+folly::dynamic ScrollEvent(int64_t target, double y) {
+  return folly::dynamic::object("target", target)("contentOffset", folly::dynamic::object("x", 0)("y", y));
+}
+
+std::vector<EventCoalescingQueue::Event> FlushAll(EventCoalescingQueue &queue) {
+  std::vector<EventCoalescingQueue::Event> events;
+  queue.Flush([&events](EventCoalescingQueue::Event &&event) { events.push_back(std::move(event)); });
+  return events;
+}
+
+} // namespace
+
+TEST_CLASS(EventCoalescingQueueTests) {
+  TEST_METHOD(EventCoalescingQueueTests_MergesConsecutiveScrolls) {
+    EventCoalescingQueue queue;
+    Assert::IsTrue(queue.Enqueue(5, "topScroll", ScrollEvent(5, 10)));
+    Assert::IsFalse(queue.Enqueue(5, "topScroll", ScrollEvent(5, 20)));
+    Assert::IsFalse(queue.Enqueue(5, "topScroll", ScrollEvent(5, 30)));
+
+    auto events = FlushAll(queue);
+    Assert::AreEqual(size_t{1}, events.size());
+    Assert::AreEqual(30.0, events[0].eventData["contentOffset"]["y"].asDouble());
+
+    auto stats = queue.GetStats();
+    Assert::AreEqual(uint64_t{3}, stats.enqueuedEvents);
+    Assert::AreEqual(uint64_t{2}, stats.mergedEvents);
+    Assert::AreEqual(uint64_t{1}, stats.dispatchedEvents);
+    Assert::AreEqual(uint64_t{1}, stats.flushes);
+  }
+
+  TEST_METHOD(EventCoalescingQueueTests_KeepsOrderAroundOtherEvents) {
+    EventCoalescingQueue queue;
+    queue.Enqueue(5, "topScroll", ScrollEvent(5, 10));
+    queue.Enqueue(5, "topScrollEndDrag", ScrollEvent(5, 10));
+    queue.Enqueue(5, "topScroll", ScrollEvent(5, 20));
+    queue.Enqueue(6, "topScroll", ScrollEvent(6, 40));
+    queue.Enqueue(5, "topScroll", ScrollEvent(5, 30));
+
+    auto events = FlushAll(queue);
+    Assert::AreEqual(size_t{4}, events.size());
+    Assert::AreEqual(std::string("topScroll"), events[0].eventName);
+    Assert::AreEqual(std::string("topScrollEndDrag"), events[1].eventName);
+    Assert::AreEqual(int64_t{5}, events[2].viewTag);
+    Assert::AreEqual(30.0, events[2].eventData["contentOffset"]["y"].asDouble());
+    Assert::AreEqual(int64_t{6}, events[3].viewTag);
+  }
+
+  TEST_METHOD(EventCoalescingQueueTests_DistinctTargetsAreNotMerged) {
+    EventCoalescingQueue queue;
+    queue.Enqueue(5, "topMouseMove", folly::dynamic::object("target", 7));
+    queue.Enqueue(5, "topMouseMove", folly::dynamic::object("target", 8));
+    queue.Enqueue(5, "topMouseEnter", folly::dynamic::object("target", 8));
+    queue.Enqueue(5, "topMouseEnter", folly::dynamic::object("target", 8));
+
+    Assert::AreEqual(size_t{4}, FlushAll(queue).size());
+    Assert::AreEqual(uint64_t{0}, queue.GetStats().mergedEvents);
+  }
+
+  TEST_METHOD(EventCoalescingQueueTests_FlushRearmsScheduling) {
+    EventCoalescingQueue queue;
+    Assert::IsTrue(queue.Enqueue(5, "topScroll", ScrollEvent(5, 10)));
+    FlushAll(queue);
+
+    Assert::IsTrue(queue.Enqueue(5, "topScroll", ScrollEvent(5, 20)));
+    Assert::IsFalse(queue.Enqueue(6, "topChange", folly::dynamic::object()));
+    queue.Drop();
+
+    Assert::IsTrue(FlushAll(queue).empty());
+    Assert::AreEqual(uint64_t{2}, queue.GetStats().droppedEvents);
+    Assert::IsTrue(queue.Enqueue(5, "topScroll", ScrollEvent(5, 30)));
+  }
+};
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <HitTestIndex.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+constexpr int64_t c_rootTag = 1;
+
+HitTestNode MakeNode(int64_t tag, int64_t parentTag, float left, float top, float width, float height) {
+  HitTestNode node;
+  node.tag = tag;
+  node.parentTag = parentTag;
+  node.left = left;
+  node.top = top;
+  node.width = width;
+  node.height = height;
+  return node;
+}
+
+// Root 400x400 with two overlapping children; 3 is painted above 2.
+void AddOverlappingChildren(HitTestIndex &index) {
+  index.BeginRoot(c_rootTag, 400, 400);
+  index.AddNode(MakeNode(c_rootTag, -1, 0, 0, 400, 400));
+  index.AddNode(MakeNode(2, c_rootTag, 10, 10, 200, 200));
+  index.AddNode(MakeNode(3, c_rootTag, 100, 100, 200, 200));
+}
+
+} // namespace
+
+TEST_CLASS(HitTestIndexTests) {
+  TEST_METHOD(HitTestIndexTests_TopmostTargetWithAncestors) {
+    HitTestIndex index;
+    AddOverlappingChildren(index);
+    index.AddNode(MakeNode(4, 2, 20, 20, 50, 50));
+    index.EndRoot();
+
+    std::vector<int64_t> chain;
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.HitTest(c_rootTag, 150, 150, chain));
+    Assert::AreEqual(size_t{2}, chain.size());
+    Assert::AreEqual(int64_t{3}, chain[0]);
+    Assert::AreEqual(c_rootTag, chain[1]);
+
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.HitTest(c_rootTag, 40, 40, chain));
+    Assert::AreEqual(size_t{3}, chain.size());
+    Assert::AreEqual(int64_t{4}, chain[0]);
+    Assert::AreEqual(int64_t{2}, chain[1]);
+
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.HitTest(c_rootTag, 350, 20, chain));
+    Assert::AreEqual(size_t{1}, chain.size());
+    Assert::AreEqual(c_rootTag, chain[0]);
+
+    Assert::IsTrue(HitTestIndex::Result::Miss == index.HitTest(c_rootTag, 450, 20, chain));
+    Assert::IsTrue(chain.empty());
+    Assert::IsTrue(HitTestIndex::Result::Unresolved == index.HitTest(42, 20, 20, chain));
+  }
+
+  TEST_METHOD(HitTestIndexTests_TagsAtPoint) {
+    HitTestIndex index;
+    AddOverlappingChildren(index);
+    index.EndRoot();
+
+    std::set<int64_t> tags;
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.TagsAtPoint(c_rootTag, 150, 150, tags));
+    Assert::IsTrue(std::set<int64_t>{1, 2, 3} == tags);
+
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.TagsAtPoint(c_rootTag, 250, 250, tags));
+    Assert::IsTrue(std::set<int64_t>{1, 3} == tags);
+  }
+
+  TEST_METHOD(HitTestIndexTests_PointerEvents) {
+    HitTestIndex index;
+    index.BeginRoot(c_rootTag, 400, 400);
+    index.AddNode(MakeNode(c_rootTag, -1, 0, 0, 400, 400));
+
+    auto none = MakeNode(2, c_rootTag, 0, 0, 100, 100);
+    none.pointerEvents = PointerEvents::None;
+    index.AddNode(none);
+    index.AddNode(MakeNode(3, 2, 0, 0, 50, 50));
+
+    auto boxNone = MakeNode(4, c_rootTag, 100, 0, 100, 100);
+    boxNone.pointerEvents = PointerEvents::BoxNone;
+    index.AddNode(boxNone);
+    index.AddNode(MakeNode(5, 4, 0, 0, 50, 50));
+
+    auto boxOnly = MakeNode(6, c_rootTag, 200, 0, 100, 100);
+    boxOnly.pointerEvents = PointerEvents::BoxOnly;
+    index.AddNode(boxOnly);
+    index.AddNode(MakeNode(7, 6, 0, 0, 50, 50));
+    index.EndRoot();
+
+    std::vector<int64_t> chain;
+    index.HitTest(c_rootTag, 25, 25, chain);
+    Assert::AreEqual(c_rootTag, chain[0]);
+
+    index.HitTest(c_rootTag, 125, 25, chain);
+    Assert::AreEqual(int64_t{5}, chain[0]);
+    Assert::AreEqual(int64_t{4}, chain[1]);
+    index.HitTest(c_rootTag, 175, 75, chain);
+    Assert::AreEqual(c_rootTag, chain[0]);
+
+    index.HitTest(c_rootTag, 225, 25, chain);
+    Assert::AreEqual(int64_t{6}, chain[0]);
+  }
+
+  TEST_METHOD(HitTestIndexTests_Transforms) {
+    HitTestIndex index;
+    index.BeginRoot(c_rootTag, 400, 400);
+    index.AddNode(MakeNode(c_rootTag, -1, 0, 0, 400, 400));
+
+    // 100x20 bar rotated 90 degrees around its center at (150, 110)
+    auto rotated = MakeNode(2, c_rootTag, 100, 100, 100, 20);
+    rotated.transform = HitTestTransform::Translation(-50, -10)
+                            .Then(HitTestTransform{0, 1, -1, 0, 0, 0})
+                            .Then(HitTestTransform::Translation(50, 10));
+    index.AddNode(rotated);
+
+    auto scaledAway = MakeNode(3, c_rootTag, 0, 0, 400, 400);
+    scaledAway.transform = HitTestTransform{0, 0, 0, 0, 0, 0};
+    index.AddNode(scaledAway);
+    index.EndRoot();
+
+    std::vector<int64_t> chain;
+    index.HitTest(c_rootTag, 150, 70, chain);
+    Assert::AreEqual(int64_t{2}, chain[0]);
+    index.HitTest(c_rootTag, 110, 110, chain);
+    Assert::AreEqual(c_rootTag, chain[0]);
+  }
+
+  TEST_METHOD(HitTestIndexTests_ContentOutsideLayoutIsUnresolved) {
+    HitTestIndex index;
+    index.BeginRoot(c_rootTag, 400, 400);
+    index.AddNode(MakeNode(c_rootTag, -1, 0, 0, 400, 400));
+    auto scroller = MakeNode(2, c_rootTag, 0, 0, 200, 200);
+    scroller.contentOutsideLayout = true;
+    index.AddNode(scroller);
+    index.AddNode(MakeNode(3, 2, 0, 0, 50, 50));
+    index.EndRoot();
+
+    std::vector<int64_t> chain;
+    std::set<int64_t> tags;
+    Assert::IsTrue(HitTestIndex::Result::Unresolved == index.HitTest(c_rootTag, 25, 25, chain));
+    Assert::IsTrue(HitTestIndex::Result::Unresolved == index.TagsAtPoint(c_rootTag, 25, 25, tags));
+    Assert::IsTrue(HitTestIndex::Result::Hit == index.HitTest(c_rootTag, 300, 300, chain));
+  }
+
+  TEST_METHOD(HitTestIndexTests_RebuildReplacesRoot) {
+    HitTestIndex index;
+    AddOverlappingChildren(index);
+    index.EndRoot();
+
+    index.BeginRoot(c_rootTag, 400, 400);
+    index.AddNode(MakeNode(c_rootTag, -1, 0, 0, 400, 400));
+    index.EndRoot();
+
+    std::vector<int64_t> chain;
+    index.HitTest(c_rootTag, 150, 150, chain);
+    Assert::AreEqual(size_t{1}, chain.size());
+
+    index.RemoveRoot(c_rootTag);
+    Assert::IsFalse(index.HasRoot(c_rootTag));
+  }
+};
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <IdleCallbackScheduler.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Frames start every 16ms on this fake clock.
+struct FakeFrames {
+  IdleCallbackScheduler scheduler{16ms, 1ms};
+  IdleCallbackScheduler::TimePoint now{1s};
+
+  // Runs a frame whose own work takes workTime, then advances to the start
+  // of the next frame. Returns whether idle callbacks were sent.
+  bool Frame(IdleCallbackScheduler::Duration workTime, IdleCallbackScheduler::Duration frameTime = 16ms) {
+    const auto frameStart = now;
+    scheduler.BeginFrame(frameStart);
+    const bool sent = scheduler.EndFrameWork(frameStart + workTime);
+    now = frameStart + frameTime;
+    return sent;
+  }
+};
+
+} // namespace
+
+TEST_CLASS(IdleCallbackSchedulerTests) {
+  TEST_METHOD(IdleCallbackSchedulerTests_SendsOnlyWhenEnabled) {
+    FakeFrames frames;
+    Assert::IsFalse(frames.Frame(2ms));
+
+    frames.scheduler.SetEnabled(true);
+    Assert::IsTrue(frames.Frame(2ms));
+    Assert::IsTrue(frames.Frame(2ms));
+
+    frames.scheduler.SetEnabled(false);
+    Assert::IsFalse(frames.Frame(2ms));
+    Assert::AreEqual(uint64_t{2}, frames.scheduler.GetStats().idleEventsSent);
+  }
+
+  TEST_METHOD(IdleCallbackSchedulerTests_ReportsRemainingBudget) {
+    FakeFrames frames;
+    frames.scheduler.SetEnabled(true);
+    frames.scheduler.BeginFrame(frames.now);
+    Assert::IsTrue(frames.scheduler.EndFrameWork(frames.now + 6ms));
+    Assert::IsTrue(frames.scheduler.FrameStart() == frames.now);
+    Assert::IsTrue(frames.scheduler.RemainingBudget(frames.now + 6ms) == 10ms);
+    Assert::IsTrue(frames.scheduler.RemainingBudget(frames.now + 20ms) == 0ms);
+  }
+
+  TEST_METHOD(IdleCallbackSchedulerTests_SkipsFramesWithoutBudget) {
+    FakeFrames frames;
+    frames.scheduler.SetEnabled(true);
+    Assert::IsFalse(frames.Frame(15500us));
+    Assert::IsTrue(frames.Frame(14ms));
+    Assert::AreEqual(uint64_t{1}, frames.scheduler.GetStats().skippedNoBudget);
+  }
+
+  TEST_METHOD(IdleCallbackSchedulerTests_SkipsFrameAfterOverrun) {
+    FakeFrames frames;
+    frames.scheduler.SetEnabled(true);
+    Assert::IsTrue(frames.Frame(2ms));
+
+    // The frame's own work runs past its deadline.
+    Assert::IsFalse(frames.Frame(20ms, 32ms));
+    Assert::IsFalse(frames.Frame(2ms));
+    Assert::IsTrue(frames.Frame(2ms));
+
+    // Something else held the thread and a whole frame was missed.
+    Assert::IsTrue(frames.Frame(2ms, 40ms));
+    Assert::IsFalse(frames.Frame(2ms));
+    Assert::IsTrue(frames.Frame(2ms));
+
+    Assert::AreEqual(uint64_t{2}, frames.scheduler.GetStats().skippedOverrun);
+  }
+
+  TEST_METHOD(IdleCallbackSchedulerTests_GapWhileDisabledIsNotAnOverrun) {
+    FakeFrames frames;
+    frames.scheduler.SetEnabled(true);
+    Assert::IsTrue(frames.Frame(2ms));
+    frames.scheduler.SetEnabled(false);
+    frames.now += 5s;
+
+    frames.scheduler.SetEnabled(true);
+    Assert::IsTrue(frames.Frame(2ms));
+  }
+};
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <Animated/KeyframeCache.h>
+#include <CppUnitTest.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+std::function<std::vector<Keyframe>()> Curve(double endValue, int &generated) {
+  return [endValue, &generated]() {
+    ++generated;
+    return std::vector<Keyframe>{{0.0, 0.0}, {1.0, endValue}};
+  };
+}
+
+} // namespace
+
+TEST_CLASS(KeyframeCacheTests) {
+  TEST_METHOD(KeyframeCacheTests_RepeatedKeyHits) {
+    KeyframeCache cache;
+    int generated = 0;
+    auto first = cache.GetOrCreate({2.0, 100.0, 10.0}, Curve(1.0, generated));
+    auto second = cache.GetOrCreate({2.0, 100.0, 10.0}, Curve(2.0, generated));
+    auto other = cache.GetOrCreate({2.0, 100.0, 11.0}, Curve(3.0, generated));
+
+    Assert::IsTrue(first == second);
+    Assert::AreEqual(3.0, other->back().value);
+    Assert::AreEqual(2, generated);
+
+    auto stats = cache.GetStats();
+    Assert::AreEqual(uint64_t{1}, stats.hits);
+    Assert::AreEqual(uint64_t{2}, stats.misses);
+  }
+
+  TEST_METHOD(KeyframeCacheTests_EvictsLeastRecentlyUsed) {
+    KeyframeCache cache(2);
+    int generated = 0;
+    cache.GetOrCreate({1.0}, Curve(1.0, generated));
+    cache.GetOrCreate({2.0}, Curve(2.0, generated));
+    cache.GetOrCreate({1.0}, Curve(1.0, generated));
+    cache.GetOrCreate({3.0}, Curve(3.0, generated));
+    Assert::AreEqual(uint64_t{1}, cache.GetStats().evictions);
+
+    cache.GetOrCreate({1.0}, Curve(1.0, generated));
+    Assert::AreEqual(3, generated);
+    cache.GetOrCreate({2.0}, Curve(2.0, generated));
+    Assert::AreEqual(4, generated);
+  }
+
+  TEST_METHOD(KeyframeCacheTests_KeysCompareBitwise) {
+    KeyframeCache cache;
+    int generated = 0;
+    cache.GetOrCreate({0.0}, Curve(1.0, generated));
+    cache.GetOrCreate({-0.0}, Curve(1.0, generated));
+    cache.GetOrCreate({0.0, 0.0}, Curve(1.0, generated));
+    Assert::AreEqual(3, generated);
+
+    cache.Clear();
+    cache.GetOrCreate({0.0}, Curve(1.0, generated));
+    Assert::AreEqual(4, generated);
+  }
+};
@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <Animated/NativeAnimatedEvent.h>
+#include <CppUnitTest.h>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+TEST_CLASS(NativeAnimatedEventTests) {
+  TEST_METHOD(NativeAnimatedEventTests_CompilesScrollPaths) {
+    Assert::IsTrue(CompileNativeEventPath({"contentOffset", "y"}) == NativeEventField::ContentOffsetY);
+    Assert::IsTrue(CompileNativeEventPath({"contentOffset", "x"}) == NativeEventField::ContentOffsetX);
+    Assert::IsTrue(
+        CompileNativeEventPath({"layoutMeasurement", "height"}) == NativeEventField::LayoutMeasurementHeight);
+    Assert::IsTrue(CompileNativeEventPath({"zoomScale"}) == NativeEventField::ZoomScale);
+    Assert::IsTrue(CompileNativeEventPath({"pageX"}) == NativeEventField::PageX);
+  }
+
+  TEST_METHOD(NativeAnimatedEventTests_RejectsUnknownPaths) {
+    Assert::IsFalse(CompileNativeEventPath({}).has_value());
+    Assert::IsFalse(CompileNativeEventPath({"contentOffset"}).has_value());
+    Assert::IsFalse(CompileNativeEventPath({"contentOffset", "z"}).has_value());
+    Assert::IsFalse(CompileNativeEventPath({"y", "contentOffset"}).has_value());
+    Assert::IsFalse(CompileNativeEventPath({"contentOffset", "y", "z"}).has_value());
+    Assert::IsFalse(CompileNativeEventPath({"x"}).has_value());
+  }
+
+  TEST_METHOD(NativeAnimatedEventTests_ReadsOnlySetFields) {
+    NativeAnimatedEvent event;
+    event.Set(NativeEventField::ContentOffsetY, 120.5);
+    event.Set(NativeEventField::ZoomScale, 0.0);
+
+    Assert::AreEqual(120.5, *event.Get(NativeEventField::ContentOffsetY));
+    Assert::AreEqual(0.0, *event.Get(NativeEventField::ZoomScale));
+    Assert::IsFalse(event.Get(NativeEventField::ContentOffsetX).has_value());
+    Assert::IsFalse(event.Get(NativeEventField::LocationY).has_value());
+  }
+};
@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+#include <NodePool.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+struct Node {
+  std::function<void()> func;
+  Node *next{nullptr};
+};
+
+// Posts tasksPerProducer empty tasks to a CxxMessageQueue from each producer
+// while its runloop runs them. Returns the time per task.
+double PostAndRun(size_t producerCount, size_t tasksPerProducer, size_t maxPooledTasks) {
+  auto queue = std::make_shared<CxxMessageQueue>(nullptr, maxPooledTasks);
+  std::thread runLoop(CxxMessageQueue::getRunLoop(queue));
+  std::atomic<size_t> ran{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < producerCount; ++p) {
+    producers.emplace_back([&] {
+      for (size_t i = 0; i < tasksPerProducer; ++i)
+        queue->runOnQueue([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+    });
+  }
+  for (auto &producer : producers)
+    producer.join();
+
+  // Runs after every task posted above.
+  queue->runOnQueueSync([] {});
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  queue->quitSynchronous();
+  runLoop.join();
+  Assert::AreEqual(producerCount * tasksPerProducer, ran.load());
+  return std::chrono::duration<double, std::nano>(elapsed).count() / (producerCount * tasksPerProducer);
+}
+
+} // namespace
+
+TEST_CLASS(NodePoolTests) {
+  TEST_METHOD(NodePoolTests_ReusesDestroyedNodes) {
+    NodePool<Node> pool;
+    Node *first = pool.Create();
+    pool.Destroy(first);
+
+    Node *second = pool.Create();
+    Assert::IsTrue(first == second);
+    Assert::IsFalse(static_cast<bool>(second->func));
+    pool.Destroy(second);
+    Assert::AreEqual(size_t{0}, pool.HeapAllocations());
+  }
+
+  TEST_METHOD(NodePoolTests_GrowsBeyondOneSlab) {
+    NodePool<Node> pool;
+    std::vector<Node *> nodes;
+    for (size_t i = 0; i < 3 * NodePool<Node>::c_cellsPerSlab; ++i)
+      nodes.push_back(pool.Create());
+
+    Assert::AreEqual(nodes.size(), std::set<Node *>(nodes.begin(), nodes.end()).size());
+    for (auto node : nodes)
+      pool.Destroy(node);
+    Assert::AreEqual(size_t{0}, pool.HeapAllocations());
+  }
+
+  TEST_METHOD(NodePoolTests_NodesAreNotSharedAcrossThreads) {
+    NodePool<Node> pool;
+    std::atomic<bool> shared{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&pool, &shared, t] {
+        std::vector<Node *> nodes;
+        for (int round = 0; round < 2000; ++round) {
+          for (int i = 0; i < 16; ++i) {
+            Node *node = pool.Create();
+            node->next = reinterpret_cast<Node *>(static_cast<intptr_t>(t + 1));
+            nodes.push_back(node);
+          }
+          for (auto node : nodes) {
+            if (node->next != reinterpret_cast<Node *>(static_cast<intptr_t>(t + 1)))
+              shared = true;
+            pool.Destroy(node);
+          }
+          nodes.clear();
+        }
+      });
+    }
+    for (auto &thread : threads)
+      thread.join();
+
+    Assert::IsFalse(shared.load());
+  }
+
+  TEST_METHOD(NodePoolTests_ZeroCellsUsesTheHeap) {
+    NodePool<Node> pool(0);
+    Node *node = pool.Create();
+    Assert::AreEqual(size_t{1}, pool.HeapAllocations());
+    pool.Destroy(node);
+  }
+
+  // Compares the post and run path of a CxxMessageQueue with its task nodes
+  // pooled against the same queue allocating every node on the heap.
+  BEGIN_TEST_METHOD_ATTRIBUTE(NodePoolTests_Benchmark)
+  TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(NodePoolTests_Benchmark) {
+    constexpr size_t tasksPerProducer = 200000;
+    for (size_t producerCount : {1, 4}) {
+      const double heap = PostAndRun(producerCount, tasksPerProducer, 0);
+      const double pooled = PostAndRun(producerCount, tasksPerProducer, CxxMessageQueue::c_defaultMaxPooledTasks);
+
+      Logger::WriteMessage((std::to_wstring(producerCount) + L" producers: new/delete " + std::to_wstring(heap) +
+                            L" ns/task, pooled " + std::to_wstring(pooled) + L" ns/task\n")
+                               .c_str());
+    }
+  }
+};
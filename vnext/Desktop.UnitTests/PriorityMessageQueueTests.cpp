@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <PriorityMessageQueue.h>
+
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+using Lanes = TaskLanes<std::string>;
+
+std::string Drain(Lanes &lanes) {
+  std::string order;
+  while (!lanes.IsEmpty())
+    order += lanes.Pop();
+  return order;
+}
+
+// Runs tasks right away; records whether they came with a priority.
+class RecordingQueue : public MessageQueueThread {
+ public:
+  void runOnQueue(std::function<void()> &&func) override {
+    order += "fifo ";
+    func();
+  }
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+  void quitSynchronous() override {}
+
+  std::string order;
+};
+
+class RecordingPriorityQueue : public RecordingQueue, public IPriorityMessageQueue {
+ public:
+  void runOnQueueWithPriority(TaskPriority priority, std::function<void()> &&func) override {
+    order += "priority" + std::to_string(static_cast<int>(priority)) + " ";
+    func();
+  }
+};
+
+} // namespace
+
+TEST_CLASS(PriorityMessageQueueTests) {
+  TEST_METHOD(PriorityMessageQueueTests_NormalTasksStayInOrder) {
+    Lanes lanes;
+    for (const char *task : {"a", "b", "c", "d", "e", "f"})
+      lanes.Push(TaskPriority::Normal, task);
+    Assert::AreEqual(std::string("abcdef"), Drain(lanes));
+  }
+
+  TEST_METHOD(PriorityMessageQueueTests_UrgentTasksRunFirst) {
+    Lanes lanes;
+    lanes.Push(TaskPriority::Background, "b");
+    lanes.Push(TaskPriority::Normal, "n");
+    lanes.Push(TaskPriority::UserBlocking, "u");
+    Assert::IsTrue(lanes.HighestPriority() == TaskPriority::UserBlocking);
+    Assert::AreEqual(std::string("unb"), Drain(lanes));
+  }
+
+  TEST_METHOD(PriorityMessageQueueTests_LowerLanesAreNotStarved) {
+    Lanes lanes;
+    lanes.Push(TaskPriority::Normal, "n");
+    for (int i = 0; i < 10; ++i)
+      lanes.Push(TaskPriority::UserBlocking, "u");
+
+    // Normal tolerates being passed over 4 times.
+    Assert::AreEqual(std::string("uuuunuuuuuu"), Drain(lanes));
+  }
+
+  TEST_METHOD(PriorityMessageQueueTests_BackgroundGetsATurnUnderLoad) {
+    Lanes lanes;
+    lanes.Push(TaskPriority::Background, "b");
+    std::string order;
+    // A steady stream of normal work: one new task for each one run.
+    for (int i = 0; i < 20; ++i) {
+      lanes.Push(TaskPriority::Normal, "n");
+      order += lanes.Pop();
+    }
+    Assert::AreEqual(size_t{16}, order.find('b'));
+  }
+
+  TEST_METHOD(PriorityMessageQueueTests_FallsBackToFifoQueues) {
+    RecordingQueue fifo;
+    bool ran = false;
+    RunOnQueueWithPriority(fifo, TaskPriority::UserBlocking, [&ran] { ran = true; });
+    Assert::IsTrue(ran);
+    Assert::AreEqual(std::string("fifo "), fifo.order);
+
+    RecordingPriorityQueue prioritized;
+    RunOnQueueWithPriority(prioritized, TaskPriority::Background, [] {});
+    prioritized.runOnQueue([] {});
+    Assert::AreEqual(std::string("priority2 fifo "), prioritized.order);
+  }
+};
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+#include <QueueStats.h>
+#include <Tracing.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct LongTaskTraceHandler : INativeTraceHandler {
+  void JSBeginSection(const char *, const char *) noexcept override {}
+  void JSEndSection() noexcept override {}
+  void JSBeginAsyncSection(const char *, int) noexcept override {}
+  void JSEndAsyncSection(const char *, int) noexcept override {}
+  void JSCounter(const char *, int) noexcept override {}
+  void NativeBeginSection(const char *, const char *) noexcept override {}
+
+  void NativeEndSection(const char *profileName, const char *args, std::chrono::nanoseconds duration) noexcept
+      override {
+    name = profileName;
+    arguments = args;
+    sectionDuration = duration;
+  }
+
+  std::string name;
+  std::string arguments;
+  std::chrono::nanoseconds sectionDuration{0};
+};
+
+} // namespace
+
+TEST_CLASS(QueueStatsTests) {
+  TEST_METHOD(QueueStatsTests_AtomicHistogramMatchesLog2Histogram) {
+    AtomicLog2Histogram atomicHistogram;
+    Log2Histogram histogram;
+    for (uint64_t value : {0, 1, 2, 3, 4, 1000, 40000, 1'000'000'000}) {
+      atomicHistogram.Add(value);
+      histogram.Add(static_cast<double>(value));
+    }
+
+    auto snapshot = atomicHistogram.GetSnapshot();
+    for (size_t i = 0; i < Log2Histogram::c_bucketCount; ++i)
+      Assert::AreEqual(histogram.buckets[i], snapshot.buckets[i]);
+    Assert::AreEqual(histogram.count, snapshot.count);
+    Assert::AreEqual(histogram.sum, snapshot.sum);
+    Assert::AreEqual(histogram.max, snapshot.max);
+  }
+
+  TEST_METHOD(QueueStatsTests_AtomicHistogramAddsFromManyThreads) {
+    AtomicLog2Histogram histogram;
+    std::vector<std::thread> threads;
+    for (uint64_t t = 1; t <= 4; ++t) {
+      threads.emplace_back([&histogram, t]() {
+        for (int i = 0; i < 10000; ++i)
+          histogram.Add(t);
+      });
+    }
+    for (auto &thread : threads)
+      thread.join();
+
+    auto snapshot = histogram.GetSnapshot();
+    Assert::AreEqual(uint64_t{40000}, snapshot.count);
+    Assert::AreEqual(100000.0, snapshot.sum);
+    Assert::AreEqual(4.0, snapshot.max);
+  }
+
+  TEST_METHOD(QueueStatsTests_RecordsWaitRunAndDepth) {
+    QueueStats stats{"test"};
+    stats.RecordPost();
+    stats.RecordPost();
+    stats.RecordPost();
+    stats.RecordTask(250us, 3ms);
+    stats.RecordCancel();
+    stats.RecordPost();
+
+    auto snapshot = stats.GetSnapshot();
+    Assert::AreEqual(uint64_t{4}, snapshot.posted);
+    Assert::AreEqual(uint64_t{1}, snapshot.ran);
+    Assert::AreEqual(uint64_t{1}, snapshot.canceled);
+    Assert::AreEqual(uint64_t{0}, snapshot.longTasks);
+    Assert::AreEqual(250.0, snapshot.waitUs.max);
+    Assert::AreEqual(3000.0, snapshot.runUs.max);
+    // Depths 1, 2, 3 and then 2 after one task ran and one was canceled.
+    Assert::AreEqual(3.0, snapshot.depth.max);
+    Assert::AreEqual(2.0, snapshot.depth.Mean());
+
+    stats.Reset();
+    snapshot = stats.GetSnapshot();
+    Assert::AreEqual(uint64_t{0}, snapshot.posted);
+    Assert::AreEqual(uint64_t{0}, snapshot.runUs.count);
+  }
+
+  TEST_METHOD(QueueStatsTests_ReportsLongTasks) {
+    LongTaskTraceHandler handler;
+    InitializeTracing(&handler);
+
+    QueueStats stats{"JS", 10ms};
+    stats.RecordPost();
+    stats.RecordTask(1ms, 5ms);
+    Assert::IsTrue(handler.name.empty());
+
+    stats.RecordPost();
+    stats.RecordTask(2ms, 25ms);
+    InitializeTracing(nullptr);
+
+    Assert::AreEqual(uint64_t{1}, stats.GetSnapshot().longTasks);
+    Assert::AreEqual(std::string{"QueueLongTask"}, handler.name);
+    Assert::AreEqual(std::string{"queue=JS waitUs=2000 runUs=25000"}, handler.arguments);
+    Assert::IsTrue(handler.sectionDuration == 25ms);
+  }
+
+  TEST_METHOD(QueueStatsTests_MeasuredTaskRecordsWhenCalled) {
+    auto stats = std::make_shared<QueueStats>("test");
+    bool ran = false;
+    auto task = MakeMeasuredTask(stats, [&ran]() { ran = true; });
+    Assert::AreEqual(uint64_t{1}, stats->GetSnapshot().posted);
+    Assert::AreEqual(uint64_t{0}, stats->GetSnapshot().ran);
+
+    task();
+    Assert::IsTrue(ran);
+    Assert::AreEqual(uint64_t{1}, stats->GetSnapshot().ran);
+  }
+
+  TEST_METHOD(QueueStatsTests_QueueCancelsTasksLeftAtDestruction) {
+    auto stats = std::make_shared<QueueStats>("test");
+    auto queue = std::make_shared<CxxMessageQueue>(stats);
+    std::thread runLoop(CxxMessageQueue::getRunLoop(queue));
+    queue->quitSynchronous();
+    runLoop.join();
+
+    // Posted after the runloop returned, so they never run.
+    queue->runOnQueue([]() {});
+    queue->runOnQueue([]() {});
+    queue.reset();
+
+    Assert::AreEqual(uint64_t{2}, stats->GetSnapshot().posted);
+    Assert::AreEqual(uint64_t{2}, stats->GetSnapshot().canceled);
+    Assert::AreEqual(uint64_t{0}, stats->GetSnapshot().ran);
+
+    // The next post sees an empty queue.
+    stats->Reset();
+    stats->RecordPost();
+    Assert::AreEqual(1.0, stats->GetSnapshot().depth.max);
+  }
+};
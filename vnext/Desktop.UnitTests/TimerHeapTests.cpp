@@ -0,0 +1,200 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <TimerHeap.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::chrono_literals;
+
+namespace {
+
+using TimePoint = std::chrono::time_point<std::chrono::steady_clock, std::chrono::milliseconds>;
+using Timers = TimerHeap<TimePoint>;
+
+Timers::Timer MakeTimer(int64_t id, int64_t dueMs, int64_t slackMs = 0) {
+  return Timers::Timer{
+      id, TimePoint(std::chrono::milliseconds(dueMs)), 16ms, false, std::chrono::milliseconds(slackMs)};
+}
+
+TimePoint At(int64_t ms) {
+  return TimePoint(std::chrono::milliseconds(ms));
+}
+
+std::vector<int64_t> Drain(Timers &timers) {
+  std::vector<int64_t> ids;
+  while (!timers.IsEmpty()) {
+    ids.push_back(timers.Front().Id);
+    timers.Pop();
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST_CLASS(TimerHeapTests) {
+  TEST_METHOD(TimerHeapTests_PopsInDueOrder) {
+    Timers timers;
+    timers.Push(MakeTimer(1, 100));
+    timers.Push(MakeTimer(2, 20));
+    timers.Push(MakeTimer(3, 50));
+    timers.Push(MakeTimer(4, 20));
+
+    Assert::IsTrue(Drain(timers) == std::vector<int64_t>{2, 4, 3, 1});
+  }
+
+  TEST_METHOD(TimerHeapTests_RemovesById) {
+    Timers timers;
+    for (int64_t id = 0; id < 10; ++id)
+      timers.Push(MakeTimer(id, 100 - id * 10));
+
+    Assert::IsTrue(timers.Remove(9));
+    Assert::IsTrue(timers.Remove(4));
+    Assert::IsFalse(timers.Remove(4));
+    Assert::IsFalse(timers.Remove(42));
+    Assert::IsFalse(timers.Contains(4));
+    Assert::AreEqual(size_t{8}, timers.Size());
+
+    Assert::IsTrue(Drain(timers) == std::vector<int64_t>{8, 7, 6, 5, 3, 2, 1, 0});
+  }
+
+  TEST_METHOD(TimerHeapTests_PushReplacesSameId) {
+    Timers timers;
+    timers.Push(MakeTimer(1, 10));
+    timers.Push(MakeTimer(2, 20));
+    timers.Push(MakeTimer(1, 30));
+
+    Assert::AreEqual(size_t{2}, timers.Size());
+    Assert::IsTrue(Drain(timers) == std::vector<int64_t>{2, 1});
+  }
+
+  TEST_METHOD(TimerHeapTests_MatchesSortedOrderUnderRandomRemoval) {
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int64_t> due(0, 1000);
+
+    Timers timers;
+    std::vector<std::pair<int64_t, int64_t>> expected; // due, id
+    for (int64_t id = 0; id < 2000; ++id) {
+      const auto dueMs = due(random);
+      timers.Push(MakeTimer(id, dueMs));
+      expected.emplace_back(dueMs, id);
+    }
+    for (int64_t id = 0; id < 2000; id += 3)
+      Assert::IsTrue(timers.Remove(id));
+    expected.erase(
+        std::remove_if(expected.begin(), expected.end(), [](const auto &timer) { return timer.second % 3 == 0; }),
+        expected.end());
+    std::stable_sort(
+        expected.begin(), expected.end(), [](const auto &left, const auto &right) { return left.first < right.first; });
+
+    const auto ids = Drain(timers);
+    Assert::AreEqual(expected.size(), ids.size());
+    for (size_t i = 0; i < ids.size(); ++i)
+      Assert::AreEqual(expected[i].second, ids[i]);
+  }
+
+  TEST_METHOD(TimerHeapTests_NextDeadlineIsEarliestDueTimePlusSlack) {
+    Timers timers;
+    timers.Push(MakeTimer(1, 100, 50));
+    Assert::IsTrue(timers.NextDeadline() == At(150));
+
+    // Due later, but with less slack.
+    timers.Push(MakeTimer(2, 120, 10));
+    Assert::IsTrue(timers.NextDeadline() == At(130));
+
+    // Due after the deadline, so it cannot pull it in.
+    timers.Push(MakeTimer(3, 140, 0));
+    Assert::IsTrue(timers.NextDeadline() == At(130));
+
+    timers.Push(MakeTimer(4, 105, 0));
+    Assert::IsTrue(timers.NextDeadline() == At(105));
+  }
+
+  TEST_METHOD(TimerHeapTests_NextDeadlineFollowsRemoveAndReplace) {
+    Timers timers;
+    timers.Push(MakeTimer(1, 100, 50));
+    timers.Push(MakeTimer(2, 120, 10));
+    timers.Push(MakeTimer(3, 140, 0));
+
+    Assert::IsTrue(timers.Remove(2));
+    Assert::IsTrue(timers.NextDeadline() == At(140));
+
+    // Replacing a timer drops its old deadline.
+    timers.Push(MakeTimer(3, 200, 0));
+    Assert::IsTrue(timers.NextDeadline() == At(150));
+
+    timers.Pop();
+    Assert::IsTrue(timers.NextDeadline() == At(200));
+  }
+
+  TEST_METHOD(TimerHeapTests_PopExpiredFiresTimersTogether) {
+    Timers timers;
+    timers.Push(MakeTimer(1, 100, 30));
+    timers.Push(MakeTimer(2, 110, 30));
+    timers.Push(MakeTimer(3, 110, 30));
+    timers.Push(MakeTimer(4, 125, 30));
+    timers.Push(MakeTimer(5, 200, 30));
+
+    const auto deadline = timers.NextDeadline();
+    Assert::IsTrue(deadline == At(130));
+    Assert::IsTrue(timers.PopExpired(deadline, deadline) == std::vector<int64_t>{1, 2, 3, 4});
+    Assert::IsTrue(timers.PopExpired(At(150), At(150)).empty());
+
+    const auto stats = timers.GetStats();
+    Assert::AreEqual(uint64_t{1}, stats.batches);
+    Assert::AreEqual(uint64_t{4}, stats.timersFired);
+    Assert::AreEqual(uint64_t{2}, stats.mergedDueTimes);
+  }
+
+  TEST_METHOD(TimerHeapTests_PopExpiredRequeuesRepeatingTimers) {
+    Timers timers;
+    timers.Push(Timers::Timer{1, At(10), 20ms, true});
+    timers.Push(MakeTimer(2, 15));
+
+    Assert::IsTrue(timers.PopExpired(At(16), At(16)) == std::vector<int64_t>{1, 2});
+    Assert::AreEqual(size_t{1}, timers.Size());
+    Assert::IsTrue(timers.Front().DueTime == At(36));
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(TimerHeapTests_Benchmark)
+  TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(TimerHeapTests_Benchmark) {
+    // 100k active timeouts, each cleared and scheduled again, the pattern of
+    // debounced handlers.
+    constexpr int64_t timerCount = 100000;
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int64_t> due(0, 60000);
+
+    Timers timers;
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t id = 0; id < timerCount; ++id)
+      timers.Push(MakeTimer(id, due(random)));
+    const auto pushed = std::chrono::steady_clock::now();
+
+    for (int64_t id = 0; id < timerCount; ++id) {
+      timers.Remove(id);
+      timers.Push(MakeTimer(id, due(random)));
+    }
+    const auto rescheduled = std::chrono::steady_clock::now();
+
+    const auto ids = Drain(timers);
+    const auto drained = std::chrono::steady_clock::now();
+    Assert::AreEqual(static_cast<size_t>(timerCount), ids.size());
+
+    const auto perTimer = [](auto elapsed) {
+      return std::to_wstring(std::chrono::duration<double, std::nano>(elapsed).count() / timerCount);
+    };
+    Logger::WriteMessage((L"push: " + perTimer(pushed - start) + L" ns/timer, clear and reschedule: " +
+                          perTimer(rescheduled - pushed) + L" ns/timer, pop: " + perTimer(drained - rescheduled) +
+                          L" ns/timer\n")
+                             .c_str());
+  }
+};
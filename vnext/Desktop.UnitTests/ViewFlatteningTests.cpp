@@ -0,0 +1,404 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <INativeUIManager.h>
+#include <IReactRootView.h>
+#include <IUIManager.h>
+#include <ShadowNode.h>
+#include <ViewManager.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+// A shadow node that records the native children it was given.
+struct TestShadowNode : ShadowNode {
+  void updateProperties(const folly::dynamic && /*props*/) override {
+    ++propertyUpdates;
+  }
+  void onDropViewInstance() override {}
+  void removeAllChildren() override {
+    nativeChildren.clear();
+  }
+  void AddView(ShadowNode &child, int64_t index) override {
+    nativeChildren.insert(nativeChildren.begin() + static_cast<size_t>(index), child.m_tag);
+  }
+  void RemoveChildAt(int64_t indexToRemove) override {
+    nativeChildren.erase(nativeChildren.begin() + static_cast<size_t>(indexToRemove));
+  }
+  void createView() override {
+    hasView = true;
+  }
+
+  bool hasView{false};
+  int propertyUpdates{0};
+  std::vector<int64_t> nativeChildren;
+};
+
+class TestViewManager : public IViewManager {
+ public:
+  explicit TestViewManager(const char *name) : m_name(name) {}
+
+  const char *GetName() const override {
+    return m_name;
+  }
+  folly::dynamic GetExportedViewConstants() const override {
+    return folly::dynamic::object();
+  }
+  folly::dynamic GetCommands() const override {
+    return folly::dynamic::object();
+  }
+  folly::dynamic GetNativeProps() const override {
+    return folly::dynamic::object();
+  }
+  ShadowNode *createShadow() const override {
+    return new TestShadowNode();
+  }
+  void destroyShadow(ShadowNode *node) const override {
+    delete node;
+  }
+  folly::dynamic GetConstants() const override {
+    return folly::dynamic::object();
+  }
+  folly::dynamic GetExportedCustomBubblingEventTypeConstants() const override {
+    return folly::dynamic::object();
+  }
+  folly::dynamic GetExportedCustomDirectEventTypeConstants() const override {
+    return folly::dynamic::object();
+  }
+
+ private:
+  const char *m_name;
+};
+
+struct TestRootView : IReactRootView {
+  void ResetView() override {}
+  std::string JSComponentName() const noexcept override {
+    return "Test";
+  }
+  int64_t GetActualHeight() const override {
+    return 600;
+  }
+  int64_t GetActualWidth() const override {
+    return 800;
+  }
+  int64_t GetTag() const override {
+    return m_tag;
+  }
+  void SetTag(int64_t tag) override {
+    m_tag = tag;
+  }
+
+  int64_t m_tag{0};
+};
+
+// Flattens RCTViews that only carry layout props and lets RCTView and ROOT
+// host their children, like the UWP NativeUIManager does.
+struct TestNativeUIManager : INativeUIManager {
+  void destroy() override {}
+  ShadowNode *createRootShadowNode(IReactRootView * /*rootView*/) override {
+    auto root = new TestShadowNode();
+    root->hasView = true;
+    return root;
+  }
+  void configureNextLayoutAnimation(
+      folly::dynamic && /*config*/,
+      facebook::xplat::module::CxxModule::Callback /*success*/,
+      facebook::xplat::module::CxxModule::Callback /*error*/) override {}
+  void destroyRootShadowNode(ShadowNode * /*node*/) override {}
+  void removeRootView(ShadowNode & /*rootNode*/) override {}
+  void setHost(INativeUIManagerHost *host) override {
+    m_host = host;
+  }
+  INativeUIManagerHost *getHost() override {
+    return m_host;
+  }
+  void AddRootView(ShadowNode & /*shadowNode*/, IReactRootView * /*pReactRootView*/) override {}
+  void CreateView(ShadowNode & /*shadowNode*/, folly::dynamic /*props*/) override {}
+  void AddView(ShadowNode & /*parentShadowNode*/, ShadowNode & /*childShadowNode*/, uint64_t /*index*/) override {}
+  void RemoveView(ShadowNode & /*shadowNode*/, bool /*removeChildren*/) override {}
+  void ReplaceView(ShadowNode & /*shadowNode*/) override {}
+  void UpdateView(ShadowNode & /*shadowNode*/, folly::dynamic /*props*/) override {}
+  void onBatchComplete() override {}
+  void ensureInBatch() override {}
+  void measure(
+      ShadowNode & /*shadowNode*/,
+      ShadowNode & /*shadowRoot*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+  void measureInWindow(ShadowNode & /*shadowNode*/, facebook::xplat::module::CxxModule::Callback /*callback*/)
+      override {}
+  void measureLayout(
+      ShadowNode & /*shadowNode*/,
+      ShadowNode & /*ancestorShadowNode*/,
+      facebook::xplat::module::CxxModule::Callback /*errorCallback*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+  void focus(int64_t /*reactTag*/) override {}
+  void blur(int64_t /*reactTag*/) override {}
+  void findSubviewIn(
+      ShadowNode & /*shadowNode*/,
+      float /*x*/,
+      float /*y*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+
+  bool isLayoutOnlyView(const std::string &className, const folly::dynamic &props) override {
+    static const std::vector<std::string> s_layoutProps = {
+        "collapsable", "flex", "height", "margin", "padding", "width"};
+    if (className != "RCTView")
+      return false;
+
+    if (props.isNull())
+      return true;
+
+    for (const auto &pair : props.items()) {
+      if (std::find(s_layoutProps.begin(), s_layoutProps.end(), pair.first.getString()) == s_layoutProps.end())
+        return false;
+    }
+
+    return true;
+  }
+
+  bool canHostLayoutOnlyChildren(ShadowNode &nativeParent) override {
+    return nativeParent.m_className == "RCTView" || nativeParent.m_className == "ROOT";
+  }
+
+  void OnLayoutOnlyViewPromoted(ShadowNode &shadowNode) override {
+    promotedTags.push_back(shadowNode.m_tag);
+  }
+
+  INativeUIManagerHost *m_host{nullptr};
+  std::vector<int64_t> promotedTags;
+};
+
+folly::dynamic LayoutProps() {
+  return folly::dynamic::object("flex", 1);
+}
+
+folly::dynamic StyleProps() {
+  return folly::dynamic::object("backgroundColor", 0xFF0000FF);
+}
+
+folly::dynamic Tags(std::initializer_list<int64_t> tags) {
+  folly::dynamic array = folly::dynamic::array();
+  for (int64_t tag : tags)
+    array.push_back(tag);
+  return array;
+}
+
+} // namespace
+
+TEST_CLASS(ViewFlatteningTests) {
+  TestNativeUIManager m_nativeUIManager;
+  TestRootView m_rootView;
+  std::shared_ptr<IUIManager> m_uiManager;
+  int64_t m_rootTag{0};
+
+ public:
+  ViewFlatteningTests() {
+    std::vector<std::unique_ptr<IViewManager>> viewManagers;
+    viewManagers.push_back(std::make_unique<TestViewManager>("ROOT"));
+    viewManagers.push_back(std::make_unique<TestViewManager>("RCTView"));
+    viewManagers.push_back(std::make_unique<TestViewManager>("RCTText"));
+    m_uiManager = createIUIManager(std::move(viewManagers), &m_nativeUIManager);
+    m_rootTag = m_uiManager->AddMeasuredRootView(&m_rootView);
+  }
+
+  ~ViewFlatteningTests() {
+    m_uiManager->removeRootView(m_rootTag);
+    m_uiManager = nullptr;
+  }
+
+  TestShadowNode &Find(int64_t tag) {
+    return static_cast<TestShadowNode &>(m_nativeUIManager.getHost()->GetShadowNodeForTag(tag));
+  }
+
+  void CreateView(int64_t tag, const char *className, folly::dynamic props) {
+    m_uiManager->createView(tag, className, m_rootTag, std::move(props));
+  }
+
+  void AddChild(int64_t tag, int64_t childTag, int64_t index) {
+    folly::dynamic none = folly::dynamic::array();
+    folly::dynamic addChildTags = Tags({childTag});
+    folly::dynamic addAtIndices = Tags({index});
+    m_uiManager->manageChildren(tag, none, none, addChildTags, addAtIndices, none);
+  }
+
+  void MoveChild(int64_t tag, int64_t fromIndex, int64_t toIndex) {
+    folly::dynamic none = folly::dynamic::array();
+    folly::dynamic moveFrom = Tags({fromIndex});
+    folly::dynamic moveTo = Tags({toIndex});
+    m_uiManager->manageChildren(tag, moveFrom, moveTo, none, none, none);
+  }
+
+  void RemoveChild(int64_t tag, int64_t index) {
+    folly::dynamic none = folly::dynamic::array();
+    folly::dynamic removeFrom = Tags({index});
+    m_uiManager->manageChildren(tag, none, none, none, none, removeFrom);
+  }
+
+  std::vector<int64_t> NativeChildren(int64_t tag) {
+    return Find(tag).nativeChildren;
+  }
+
+  // root -> 2 (native) -> 3 (layout-only) -> [4 (native), 5 (text)], 6 (native)
+  void CreateFlattenedTree() {
+    CreateView(2, "RCTView", StyleProps());
+    CreateView(3, "RCTView", LayoutProps());
+    CreateView(4, "RCTView", StyleProps());
+    CreateView(5, "RCTText", nullptr);
+    CreateView(6, "RCTView", StyleProps());
+    m_uiManager->setChildren(3, Tags({4, 5}));
+    m_uiManager->setChildren(m_rootTag, Tags({2, 3, 6}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_LayoutOnlyViewChildrenMountIntoNativeAncestor) {
+    CreateFlattenedTree();
+
+    Assert::IsFalse(Find(3).hasView);
+    Assert::IsTrue(Find(3).m_layoutOnly);
+    Assert::AreEqual(0, Find(3).propertyUpdates);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 4, 5, 6}));
+    Assert::IsTrue(NativeChildren(3).empty());
+    Assert::AreEqual(size_t{1}, m_uiManager->getLayoutOnlyViewStats().flattenedViews);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_NestedLayoutOnlyViewsKeepChildOrder) {
+    // root -> 2 (layout-only) -> [3 (layout-only) -> [4, 5], 6], 7
+    CreateView(2, "RCTView", LayoutProps());
+    CreateView(3, "RCTView", nullptr);
+    CreateView(4, "RCTView", StyleProps());
+    CreateView(5, "RCTView", StyleProps());
+    CreateView(6, "RCTView", StyleProps());
+    CreateView(7, "RCTView", StyleProps());
+    m_uiManager->setChildren(3, Tags({4, 5}));
+    m_uiManager->setChildren(2, Tags({3, 6}));
+    m_uiManager->setChildren(m_rootTag, Tags({2, 7}));
+
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({4, 5, 6, 7}));
+    Assert::AreEqual(size_t{2}, m_uiManager->getLayoutOnlyViewStats().flattenedViews);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_StyleUpdatePromotesLayoutOnlyView) {
+    CreateFlattenedTree();
+
+    m_uiManager->updateView(3, "RCTView", StyleProps());
+
+    // The view takes its children back and takes their place in the root.
+    Assert::IsTrue(Find(3).hasView);
+    Assert::IsFalse(Find(3).m_layoutOnly);
+    Assert::AreEqual(1, Find(3).propertyUpdates);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 3, 6}));
+    Assert::IsTrue(NativeChildren(3) == std::vector<int64_t>({4, 5}));
+    Assert::IsTrue(m_nativeUIManager.promotedTags == std::vector<int64_t>({3}));
+
+    auto stats = m_uiManager->getLayoutOnlyViewStats();
+    Assert::AreEqual(size_t{0}, stats.flattenedViews);
+    Assert::AreEqual(size_t{1}, stats.promotedViews);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_LayoutUpdateKeepsViewFlattened) {
+    CreateFlattenedTree();
+
+    m_uiManager->updateView(3, "RCTView", folly::dynamic::object("width", 100));
+
+    Assert::IsFalse(Find(3).hasView);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 4, 5, 6}));
+    Assert::IsTrue(m_nativeUIManager.promotedTags.empty());
+  }
+
+  TEST_METHOD(ViewFlatteningTests_PromotedViewIsNotFlattenedAgain) {
+    CreateFlattenedTree();
+    m_uiManager->updateView(3, "RCTView", StyleProps());
+
+    // Losing its style props does not take the view away again.
+    m_uiManager->updateView(3, "RCTView", folly::dynamic::object("backgroundColor", nullptr));
+
+    Assert::IsTrue(Find(3).hasView);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 3, 6}));
+    Assert::IsTrue(NativeChildren(3) == std::vector<int64_t>({4, 5}));
+    Assert::AreEqual(size_t{1}, m_uiManager->getLayoutOnlyViewStats().promotedViews);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_NativeViewStaysNativeWithoutStyleProps) {
+    CreateFlattenedTree();
+
+    m_uiManager->updateView(2, "RCTView", folly::dynamic::object("backgroundColor", nullptr));
+
+    Assert::IsTrue(Find(2).hasView);
+    Assert::IsFalse(Find(2).m_layoutOnly);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 4, 5, 6}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_AddChildToLayoutOnlyView) {
+    CreateFlattenedTree();
+    CreateView(7, "RCTView", StyleProps());
+
+    AddChild(3, 7, 1);
+
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 4, 7, 5, 6}));
+    Assert::AreEqual(int64_t{3}, Find(7).m_parent);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_MoveChildInsideLayoutOnlyView) {
+    CreateFlattenedTree();
+
+    MoveChild(3, 0, 1);
+
+    Assert::IsTrue(Find(3).m_children == std::vector<int64_t>({5, 4}));
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 5, 4, 6}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_RemoveChildFromLayoutOnlyView) {
+    CreateFlattenedTree();
+
+    RemoveChild(3, 0);
+
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 5, 6}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_RemoveLayoutOnlyViewRemovesFlattenedChildren) {
+    CreateFlattenedTree();
+
+    RemoveChild(m_rootTag, 1);
+
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 6}));
+    Assert::AreEqual(size_t{0}, m_uiManager->getLayoutOnlyViewStats().flattenedViews);
+  }
+
+  TEST_METHOD(ViewFlatteningTests_MoveLayoutOnlyViewMovesFlattenedChildren) {
+    CreateFlattenedTree();
+
+    MoveChild(m_rootTag, 1, 2);
+
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 6, 4, 5}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_LayoutOnlyViewUnderTextIsPromoted) {
+    // RCTText does not lay its children out by Yoga, so it cannot host them.
+    CreateView(2, "RCTText", nullptr);
+    CreateView(3, "RCTView", LayoutProps());
+    CreateView(4, "RCTView", StyleProps());
+    m_uiManager->setChildren(3, Tags({4}));
+    m_uiManager->setChildren(2, Tags({3}));
+    m_uiManager->setChildren(m_rootTag, Tags({2}));
+
+    Assert::IsTrue(Find(3).hasView);
+    Assert::IsTrue(NativeChildren(2) == std::vector<int64_t>({3}));
+    Assert::IsTrue(NativeChildren(3) == std::vector<int64_t>({4}));
+  }
+
+  TEST_METHOD(ViewFlatteningTests_FocusPromotesLayoutOnlyView) {
+    CreateFlattenedTree();
+
+    m_uiManager->focus(3);
+
+    Assert::IsTrue(Find(3).hasView);
+    Assert::IsTrue(NativeChildren(m_rootTag) == std::vector<int64_t>({2, 3, 6}));
+    Assert::IsTrue(NativeChildren(3) == std::vector<int64_t>({4, 5}));
+  }
+};
@@ -21,52 +21,39 @@ using namespace folly;
 namespace facebook {
 namespace react {
 
-bool operator<(const Timer &leftTimer, const Timer &rightTimer) {
-  return rightTimer.DueTime < leftTimer.DueTime;
-}
-
-bool operator==(const Timer &leftTimer, const uint64_t id) {
-  return id == leftTimer.Id;
-}
-
-void TimerQueue::Push(Timer timer) {
-  m_timerVector.push_back(timer);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
+/*static*/ void Timing::ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID Parameter, PTP_TIMER) noexcept {
+  static_cast<Timing *>(Parameter)->OnTimerRaised();
 }
 
-const Timer &TimerQueue::Front() const {
-  return m_timerVector.front();
+/*static*/ void Timing::FrameTimerCallback(PTP_CALLBACK_INSTANCE, PVOID Parameter, PTP_TIMER) noexcept {
+  static_cast<Timing *>(Parameter)->OnFrame(IdleCallbackScheduler::Clock::now());
 }
 
-bool TimerQueue::Remove(uint64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end()) {
-    m_timerVector.erase(found);
-  } else {
-    return false;
+void Timing::OnFrame(IdleCallbackScheduler::TimePoint frameStart) noexcept {
+  if (auto nativeThread = m_nativeThread.lock()) {
+    // Time spent waiting for the native thread counts against the frame.
+    nativeThread->runOnQueue([weakThis = std::weak_ptr<Timing>(shared_from_this()), frameStart]() {
+      auto strongThis = weakThis.lock();
+      if (!strongThis) {
+        return;
+      }
+
+      strongThis->m_idleCallbacks.BeginFrame(frameStart);
+      if (strongThis->m_idleCallbacks.EndFrameWork(IdleCallbackScheduler::Clock::now())) {
+        strongThis->SendIdleEvents();
+      }
+    });
   }
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-  return true;
-}
-
-bool TimerQueue::IsEmpty() const {
-  return m_timerVector.empty();
 }
 
-/*static*/ void Timing::ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID Parameter, PTP_TIMER) noexcept {
-  static_cast<Timing *>(Parameter)->OnTimerRaised();
+void Timing::SendIdleEvents() noexcept {
+  if (auto instance = m_wkInstance.lock()) {
+    // JSTimers measures the frame from its start, on the Date.now() clock.
+    const auto frameAge = IdleCallbackScheduler::Clock::now() - m_idleCallbacks.FrameStart();
+    const auto frameStart = std::chrono::system_clock::now() - frameAge;
+    const double frameStartMs = std::chrono::duration<double, std::milli>(frameStart.time_since_epoch()).count();
+    instance->callJSFunction("JSTimers", "callIdleCallbacks", folly::dynamic::array(frameStartMs));
+  }
 }
 
 void Timing::OnTimerRaised() noexcept {
@@ -89,22 +76,14 @@ void Timing::OnTimerRaised() noexcept {
         auto now = std::chrono::system_clock::now();
         auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
 
-        // Fire timers which will be expired in 10ms
-        while (!strongThis->m_timerQueue.IsEmpty() && now_ms > strongThis->m_timerQueue.Front().DueTime - 10ms) {
-          // Pop first timer from the queue and add it to list of timers ready
-          // to fire
-          auto next = strongThis->m_timerQueue.Front();
-          strongThis->m_timerQueue.Pop();
-
-          // VSO:1916882 potential overflow
-          readyTimers.push_back(next.Id);
-
-          // If timer is repeating push it back onto the queue for the next
-          // repetition 'next.Period' being greater than 10ms is intended to
-          // prevent infinite loops
-          if (next.Repeat)
-            strongThis->m_timerQueue.Push(Timer{next.Id, now_ms + next.Period, next.Period, true});
-        }
+        // Fire timers which will be expired in 10ms. Repeating timers are
+        // pushed back one period after now; 'Period' being greater than 10ms
+        // is intended to prevent infinite loops.
+        // VSO:1916882 potential overflow
+        for (auto id : strongThis->m_timerQueue.PopExpired(now_ms + 10ms, now_ms))
+          readyTimers.push_back(id);
+        if (strongThis->m_stats)
+          strongThis->m_stats->Publish(strongThis->m_timerQueue.GetStats());
 
         if (!readyTimers.empty()) {
           if (auto instance = strongThis->m_wkInstance.lock()) {
@@ -115,7 +94,7 @@ void Timing::OnTimerRaised() noexcept {
         }
 
         if (!strongThis->m_timerQueue.IsEmpty()) {
-          strongThis->SetKernelTimer(strongThis->m_timerQueue.Front().DueTime);
+          strongThis->SetKernelTimer(strongThis->m_timerQueue.NextDeadline());
         } else {
           strongThis->m_dueTime = DateTime::max();
         }
@@ -154,7 +133,8 @@ void Timing::createTimer(
 
   // Make sure duration is always larger than 16ms to avoid unnecessary wakeups.
   period = TimeSpan{duration < 16 ? 16 : (int64_t)duration};
-  m_timerQueue.Push(Timer{id, initialDueTime, period, repeat});
+  m_timerQueue.Push(
+      Timer{static_cast<int64_t>(id), initialDueTime, period, repeat, m_slack});
 
   TimersChanged();
 }
@@ -168,21 +148,24 @@ void Timing::TimersChanged() noexcept {
     }
     return;
   }
-  // If front timer has the same target time as ThreadpoolTimer,
+  // The kernel timer waits for the first timer to run out of slack, so that
+  // timers due close together wake us up once.
+  const auto deadline = m_timerQueue.NextDeadline();
+
+  // If the deadline is the same target time as ThreadpoolTimer,
   // we will keep ThreadpoolTimer unchanged.
-  if (m_timerQueue.Front().DueTime == m_dueTime) {
+  if (deadline == m_dueTime) {
     // do nothing
   }
-  // If current front timer's due time is earlier than current
-  // ThreadpoolTimer's, we need to reset the ThreadpoolTimer to current front
-  // timer
-  else if (m_timerQueue.Front().DueTime < m_dueTime) {
-    SetKernelTimer(m_timerQueue.Front().DueTime);
+  // If the deadline is earlier than current ThreadpoolTimer's, we need to
+  // reset the ThreadpoolTimer to it
+  else if (deadline < m_dueTime) {
+    SetKernelTimer(deadline);
   }
-  // If current front timer's due time is later than current kernel timer's,
-  // we will reset kernel timer only when it is about to fire
+  // If the deadline is later than current kernel timer's, we will reset
+  // kernel timer only when it is about to fire
   else if (KernelTimerIsAboutToFire()) {
-    SetKernelTimer(m_timerQueue.Front().DueTime);
+    SetKernelTimer(deadline);
   }
 }
 
@@ -229,7 +212,7 @@ void Timing::InitializeKernelTimer() noexcept {
 void Timing::deleteTimer(uint64_t id) noexcept {
   if (m_timerQueue.IsEmpty())
     return;
-  if (m_timerQueue.Remove(id)) {
+  if (m_timerQueue.Remove(static_cast<int64_t>(id))) {
     TimersChanged();
   }
 }
@@ -240,9 +223,26 @@ void Timing::StopKernelTimer() noexcept {
   m_dueTime = DateTime::max();
 }
 
-void Timing::setSendIdleEvents(bool /*sendIdleEvents*/) noexcept {
-  // It seems we don't need this API. Leave it empty for now.
-  assert(false && "not implemented");
+void Timing::setSendIdleEvents(std::weak_ptr<facebook::react::Instance> instance, bool sendIdleEvents) noexcept {
+  SetInstance(instance);
+  m_idleCallbacks.SetEnabled(sendIdleEvents);
+
+  if (!sendIdleEvents) {
+    if (m_frameTimer) {
+      SetThreadpoolTimer(m_frameTimer, NULL, 0, 0);
+    }
+    return;
+  }
+
+  if (!m_frameTimer) {
+    m_frameTimer = CreateThreadpoolTimer(&Timing::FrameTimerCallback, static_cast<PVOID>(this), NULL);
+    assert(m_frameTimer && "CreateThreadpoolTimer failed.");
+  }
+
+  // First frame right away, then one per frame interval.
+  FILETIME FileDueTime{};
+  const auto frameInterval = std::chrono::duration_cast<TimeSpan>(IdleCallbackScheduler::c_defaultFrameInterval);
+  SetThreadpoolTimer(m_frameTimer, &FileDueTime, static_cast<DWORD>(std::max<int64_t>(frameInterval.count(), 1)), 0);
 }
 
 Timing::~Timing() {
@@ -251,6 +251,11 @@ Timing::~Timing() {
     WaitForThreadpoolTimerCallbacks(m_threadpoolTimer, true);
     CloseThreadpoolTimer(m_threadpoolTimer);
   }
+  if (m_frameTimer) {
+    SetThreadpoolTimer(m_frameTimer, NULL, 0, 0);
+    WaitForThreadpoolTimerCallbacks(m_frameTimer, true);
+    CloseThreadpoolTimer(m_frameTimer);
+  }
 }
 
 TimingModule::TimingModule(std::shared_ptr<Timing> &&timing) : m_timing(std::move(timing)) {}
@@ -285,7 +290,7 @@ std::vector<module::CxxModule::Method> TimingModule::getMethods() noexcept {
       Method(
           "setSendIdleEvents",
           [this](dynamic args) // const std::string& message, int64_t id
-          { m_timing->setSendIdleEvents(jsArgAsBool(args, 0)); }),
+          { m_timing->setSendIdleEvents(getInstance(), jsArgAsBool(args, 0)); }),
   };
 }
 
@@ -295,5 +300,12 @@ std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
   return std::move(module);
 }
 
+std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
+    const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread,
+    double timerSlackMs,
+    std::shared_ptr<TimerStats> stats) noexcept {
+  return std::make_unique<TimingModule>(std::make_shared<Timing>(nativeThread, timerSlackMs, std::move(stats)));
+}
+
 } // namespace react
 } // namespace facebook
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <IdleCallbackScheduler.h>
 #include <InstanceManager.h>
+#include <TimerHeap.h>
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
 
@@ -19,56 +21,30 @@ namespace react {
 using DateTime = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
 using TimeSpan = std::chrono::milliseconds;
 
-// Timer struct which holds timer id, target time, period between target time
-// and scheduling time and whether it needs to be repeated. Example:
-//           std::chrono::time_point targetTime =
-//           std::chrono::system_clock::now()+100ms; Timer timer = {12345,
-//           targetTime, 100ms, false};
-struct Timer {
-  uint64_t Id;
-  DateTime DueTime;
-  TimeSpan Period;
-  bool Repeat;
-};
-
-// operator for push_heap and pop_heap
-bool operator<(const Timer &leftTimer, const Timer &rightTimer);
-
-// operator for find
-bool operator==(const Timer &leftTimer, const uint64_t id);
-
-// This class is a implementation of max heap to store Timer objects.
-// The front timer has the smallest due time.
-// Example:
+// Timers ordered by due time. Example:
 //           TimerQueue tq;
 //           tq.Push(Timer{1234, now()+100ms, 100ms, false});
 //           tq.Push(Timer{1235, now()+20ms, 20ms, false});
-//           tq.Push(Timer{1236, now()+50ms, 50ms, false});
 //           tq.Pop(); //pops timer id: 1235
-//           printf("%u", tq.Front().Id); // print 1236
-class TimerQueue {
- public:
-  void Push(Timer timer);
-  void Pop();
-  Timer &Front();
-  const Timer &Front() const;
-  bool Remove(uint64_t id);
-  bool IsEmpty() const;
-
- private:
-  // This vector is maintained as a max heap, where the front Timer has the
-  // smallest due time.
-  std::vector<Timer> m_timerVector;
-};
+//           printf("%u", tq.Front().Id); // print 1234
+using TimerQueue = TimerHeap<DateTime>;
+using Timer = TimerQueue::Timer;
 
 // Helper class which implements createTimer, deleteTimer and setSendIdleEvents
 // for actual TimingModule Example:
 //           Timing timing;
 //           timing.createTimer(instance, id, duration, jsScheduleTime, repeat);
 //           timing.delete(id);
+// Every timer may fire up to timerSlackMs late, together with other timers.
 class Timing : public std::enable_shared_from_this<Timing> {
  public:
-  Timing(const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread) : m_nativeThread(nativeThread) {}
+  Timing(
+      const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread,
+      double timerSlackMs = 0,
+      std::shared_ptr<TimerStats> stats = nullptr)
+      : m_slack(TimeSpan{timerSlackMs > 0 ? (int64_t)timerSlackMs : 0}),
+        m_stats(std::move(stats)),
+        m_nativeThread(nativeThread) {}
   ~Timing();
   void createTimer(
       std::weak_ptr<facebook::react::Instance> instance,
@@ -77,12 +53,15 @@ class Timing : public std::enable_shared_from_this<Timing> {
       double jsSchedulingTime,
       bool repeat) noexcept;
   void deleteTimer(uint64_t id) noexcept;
-  void setSendIdleEvents(bool sendIdleEvents) noexcept;
+  void setSendIdleEvents(std::weak_ptr<facebook::react::Instance> instance, bool sendIdleEvents) noexcept;
 
  private:
   static VOID CALLBACK
   ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE Instance, PVOID Parameter, PTP_TIMER Timer) noexcept;
+  static VOID CALLBACK FrameTimerCallback(PTP_CALLBACK_INSTANCE Instance, PVOID Parameter, PTP_TIMER Timer) noexcept;
   void OnTimerRaised() noexcept;
+  void OnFrame(IdleCallbackScheduler::TimePoint frameStart) noexcept;
+  void SendIdleEvents() noexcept;
   void SetInstance(std::weak_ptr<facebook::react::Instance> instance) noexcept;
   void SetKernelTimer(DateTime dueTime) noexcept;
   void InitializeKernelTimer() noexcept;
@@ -92,6 +71,13 @@ class Timing : public std::enable_shared_from_this<Timing> {
   TimerQueue m_timerQueue;
   PTP_TIMER m_threadpoolTimer = NULL;
   DateTime m_dueTime;
+  TimeSpan m_slack;
+  std::shared_ptr<TimerStats> m_stats;
+
+  // There is no rendering loop on Desktop; while JS wants idle callbacks, a
+  // periodic timer stands in for frames.
+  IdleCallbackScheduler m_idleCallbacks;
+  PTP_TIMER m_frameTimer = NULL;
 
   std::weak_ptr<facebook::react::Instance> m_wkInstance;
   std::weak_ptr<facebook::react::MessageQueueThread> m_nativeThread;
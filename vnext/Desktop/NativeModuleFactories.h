@@ -10,12 +10,19 @@
 namespace facebook {
 namespace react {
 
+class TimerStats;
+
 extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateAsyncStorageModule(
     const WCHAR *storageFileName) noexcept;
 
 extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
     const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread) noexcept;
 
+extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
+    const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread,
+    double timerSlackMs,
+    std::shared_ptr<TimerStats> stats) noexcept;
+
 extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateWebSocketModule() noexcept;
 
 } // namespace react
@@ -39,6 +39,7 @@
 #endif // PATCH_RN
 
 #include <tuple>
+#include <utility>
 
 namespace react::uwp {
 
@@ -403,33 +404,47 @@ std::string ReactInstanceWin::LastErrorMessage() const noexcept {
 void ReactInstanceWin::InitJSMessageThread() noexcept {
   // Use the explicit JSQueue if it is provided.
   const auto &properties = m_options.Properties;
+  auto jsQueueStats = m_options.LegacySettings.JSQueueStats;
   auto jsDispatchQueue = Mso::DispatchQueue{properties.Get(JSDispatchQueueProperty)};
   if (jsDispatchQueue) {
     VerifyElseCrashSz(jsDispatchQueue.IsSerial(), "JS Queue must be sequential");
   } else {
     // Currently we have to use Looper DispatchQueue because our JS Engine based on Chakra uses thread local storage.
     jsDispatchQueue = Mso::DispatchQueue::MakeLooperQueue();
+
+    // The queue is ours: observe all of its tasks instead of the ones posted through the MessageQueueThread.
+    react::uwp::ObserveQueueStats(jsDispatchQueue, std::exchange(jsQueueStats, nullptr));
   }
 
   // Create MessageQueueThread for the DispatchQueue
   VerifyElseCrashSz(jsDispatchQueue, "m_jsDispatchQueue must not be null");
   m_jsMessageThread.Exchange(std::make_shared<MessageDispatchQueue>(
-      jsDispatchQueue, Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError), Mso::Copy(m_whenDestroyed)));
+      jsDispatchQueue,
+      Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+      Mso::Copy(m_whenDestroyed),
+      std::move(jsQueueStats)));
   m_jsDispatchQueue.Exchange(std::move(jsDispatchQueue));
 }
 
 void ReactInstanceWin::InitNativeMessageThread() noexcept {
   // Native queue was already given us in constructor.
-  m_nativeMessageThread.Exchange(
-      std::make_shared<MessageDispatchQueue>(Queue(), Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
+  m_nativeMessageThread.Exchange(std::make_shared<MessageDispatchQueue>(
+      Queue(),
+      Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+      nullptr,
+      m_options.LegacySettings.NativeQueueStats));
 }
 
 void ReactInstanceWin::InitUIMessageThread() noexcept {
   // Native queue was already given us in constructor.
   m_uiMessageThread.Exchange(std::make_shared<MessageDispatchQueue>(
-      Mso::DispatchQueue::MainUIQueue(), Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
+      Mso::DispatchQueue::MainUIQueue(),
+      Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+      nullptr,
+      m_options.LegacySettings.UIQueueStats));
 
-  m_batchingUIThread = react::uwp::MakeBatchingQueueThread(m_uiMessageThread.Load());
+  m_batchingUIThread =
+      react::uwp::MakeBatchingQueueThread(m_uiMessageThread.Load(), m_options.LegacySettings.BatchingUIQueueStats);
 }
 
 void ReactInstanceWin::InitUIManager() noexcept {
@@ -132,6 +132,14 @@ ExpressionAnimationStore &UwpReactInstanceProxy::GetExpressionAnimationStore() {
   return m_expressionAnimationStore;
 }
 
+void UwpReactInstanceProxy::SetNativeAnimatedNodeManager(const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
+  m_nativeAnimatedNodeManager = manager;
+}
+
+std::shared_ptr<NativeAnimatedNodeManager> UwpReactInstanceProxy::GetNativeAnimatedNodeManager() const {
+  return m_nativeAnimatedNodeManager.lock();
+}
+
 const ReactInstanceSettings &UwpReactInstanceProxy::GetReactInstanceSettings() const {
   return m_instanceSettings;
 }
@@ -49,6 +49,8 @@ struct UwpReactInstanceProxy : IReactInstance, std::enable_shared_from_this<UwpR
   const std::string &LastErrorMessage() const noexcept override;
   void loadBundle(std::string &&jsBundleRelativePath) override;
   ExpressionAnimationStore &GetExpressionAnimationStore() override;
+  void SetNativeAnimatedNodeManager(const std::shared_ptr<NativeAnimatedNodeManager> &manager) override;
+  std::shared_ptr<NativeAnimatedNodeManager> GetNativeAnimatedNodeManager() const override;
   const ReactInstanceSettings &GetReactInstanceSettings() const override;
   std::string GetBundleRootPath() const noexcept override;
 
@@ -60,6 +62,7 @@ struct UwpReactInstanceProxy : IReactInstance, std::enable_shared_from_this<UwpR
   Mso::WeakPtr<Mso::React::IReactInstance> m_weakReactInstance;
   ReactInstanceSettings m_instanceSettings;
   ExpressionAnimationStore m_expressionAnimationStore;
+  std::weak_ptr<NativeAnimatedNodeManager> m_nativeAnimatedNodeManager;
   std::function<void(XamlView)> m_xamlViewCreatedTestHook;
 };
 
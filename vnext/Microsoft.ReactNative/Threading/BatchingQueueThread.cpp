@@ -8,15 +8,20 @@
 namespace react::uwp {
 
 BatchingQueueThread::BatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept
-    : m_queueThread{queueThread} {}
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::shared_ptr<facebook::react::QueueStats> stats) noexcept
+    : m_queueThread{queueThread}, m_stats{std::move(stats)} {}
 
 BatchingQueueThread::~BatchingQueueThread() noexcept {}
 
 void BatchingQueueThread::runOnQueue(std::function<void()> &&func) noexcept {
   ThreadCheck();
-  EnsureQueue();
-  m_taskQueue->emplace_back(std::move(func));
+  if (m_stats) {
+    m_taskQueues.Current().Push(
+        facebook::react::TaskPriority::Normal, facebook::react::MakeMeasuredTask(m_stats, std::move(func)));
+  } else {
+    m_taskQueues.Current().Push(facebook::react::TaskPriority::Normal, std::move(func));
+  }
 
 //#define TRACK_UI_CALLS
 #ifdef TRACK_UI_CALLS
@@ -37,20 +42,14 @@ void BatchingQueueThread::ThreadCheck() noexcept {
 #endif
 }
 
-void BatchingQueueThread::EnsureQueue() noexcept {
-  if (!m_taskQueue) {
-    m_taskQueue = std::make_shared<WorkItemQueue>();
-    m_taskQueue->reserve(2048);
-  }
-}
-
 void BatchingQueueThread::onBatchComplete() noexcept {
   ThreadCheck();
-  if (m_taskQueue) {
-    m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)}]() noexcept {
-      for (auto &task : *taskQueue) {
-        task();
-        task = nullptr;
+  if (auto taskQueue = m_taskQueues.TakeBatch()) {
+    // The closure only holds the shared_ptr, which std::function stores
+    // without allocating.
+    m_queueThread->runOnQueue([taskQueue{std::move(taskQueue)}]() noexcept {
+      while (!taskQueue->IsEmpty()) {
+        taskQueue->Pop()();
       }
     });
   }
@@ -3,14 +3,22 @@
 
 #pragma once
 
+#include <ReactWindowsCore/BatchBuffers.h>
 #include <ReactWindowsCore/BatchingMessageQueueThread.h>
+#include <ReactWindowsCore/PriorityMessageQueue.h>
+#include <ReactWindowsCore/QueueStats.h>
 #include <thread>
 
 namespace react::uwp {
 
-// Executes the function on the provided UI Dispatcher
+// Executes the function on the provided UI Dispatcher. The UI operations of a
+// batch depend on each other, so they run in the order they were posted, and
+// batches are posted at Normal priority.
 struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
-  BatchingQueueThread(std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+  // With stats, the wait time of a task includes the time until its batch completes.
+  BatchingQueueThread(
+      std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+      std::shared_ptr<facebook::react::QueueStats> stats = nullptr) noexcept;
   ~BatchingQueueThread() noexcept override;
 
   BatchingQueueThread() = delete;
@@ -25,14 +33,17 @@ struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
   void onBatchComplete() noexcept override;
 
  private:
-  void EnsureQueue() noexcept;
   void ThreadCheck() noexcept;
 
  private:
   std::shared_ptr<facebook::react::MessageQueueThread> m_queueThread;
+  const std::shared_ptr<facebook::react::QueueStats> m_stats;
 
-  using WorkItemQueue = std::vector<std::function<void()>>;
-  std::shared_ptr<WorkItemQueue> m_taskQueue;
+  // The batches alternate between two recycled queues, so a steady stream of
+  // batches does not allocate.
+  using WorkItemQueue =
+      facebook::react::TaskLanes<std::function<void()>, facebook::react::RecycledLane<std::function<void()>>>;
+  facebook::react::BatchBuffers<WorkItemQueue> m_taskQueues;
 
 #if DEBUG
   std::thread::id m_expectedThreadId{};
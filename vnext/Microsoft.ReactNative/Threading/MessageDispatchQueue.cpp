@@ -16,11 +16,13 @@ namespace Mso::React {
 MessageDispatchQueue::MessageDispatchQueue(
     Mso::DispatchQueue const &dispatchQueue,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept
+    Mso::Promise<void> &&whenQuit,
+    std::shared_ptr<facebook::react::QueueStats> stats) noexcept
     : m_dispatchQueue{dispatchQueue},
       m_stopped{false},
       m_errorHandler{std::move(errorHandler)},
-      m_whenQuit{std::move(whenQuit)} {}
+      m_whenQuit{std::move(whenQuit)},
+      m_stats{std::move(stats)} {}
 
 MessageDispatchQueue::~MessageDispatchQueue() noexcept {}
 
@@ -29,6 +31,25 @@ void MessageDispatchQueue::runOnQueue(std::function<void()> &&func) {
     return;
   }
 
+  if (m_stats) {
+    // Tasks dropped after quitSynchronous or canceled by the queue shutdown are recorded as canceled.
+    m_stats->RecordPost();
+    m_dispatchQueue.Post(Mso::MakeDispatchTask(
+        /*callback:*/
+        [ pThis = shared_from_this(), func = std::move(func), postTime = std::chrono::steady_clock::now() ]() noexcept {
+          if (pThis->m_stopped) {
+            pThis->m_stats->RecordCancel();
+            return;
+          }
+
+          const auto startTime = std::chrono::steady_clock::now();
+          pThis->tryFunc(func);
+          pThis->m_stats->RecordTask(startTime - postTime, std::chrono::steady_clock::now() - startTime);
+        },
+        /*onCancel:*/[stats = m_stats]() noexcept { stats->RecordCancel(); }));
+    return;
+  }
+
   m_dispatchQueue.Post([ pThis = shared_from_this(), func = std::move(func) ]() noexcept {
     if (!pThis->m_stopped) {
       pThis->tryFunc(func);
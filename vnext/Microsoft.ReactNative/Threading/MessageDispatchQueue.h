@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ReactWindowsCore/QueueStats.h>
 #include <cxxreact/MessageQueueThread.h>
 #include <functional/FunctorRef.h>
 #include <future/Future.h>
@@ -10,11 +11,14 @@
 
 namespace Mso::React {
 
+// The optional stats record the tasks posted with runOnQueue through this instance only,
+// so several instances can share a dispatch queue such as the MainUIQueue.
 struct MessageDispatchQueue : facebook::react::MessageQueueThread, std::enable_shared_from_this<MessageDispatchQueue> {
   MessageDispatchQueue(
       Mso::DispatchQueue const &dispatchQueue,
       Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-      Mso::Promise<void> &&whenQuit = nullptr) noexcept;
+      Mso::Promise<void> &&whenQuit = nullptr,
+      std::shared_ptr<facebook::react::QueueStats> stats = nullptr) noexcept;
 
   ~MessageDispatchQueue() noexcept override;
 
@@ -41,6 +45,7 @@ struct MessageDispatchQueue : facebook::react::MessageQueueThread, std::enable_s
   Mso::DispatchQueue m_dispatchQueue;
   Mso::Functor<void(const Mso::ErrorCode &)> m_errorHandler;
   const Mso::Promise<void> m_whenQuit;
+  const std::shared_ptr<facebook::react::QueueStats> m_stats;
 };
 
 } // namespace Mso::React
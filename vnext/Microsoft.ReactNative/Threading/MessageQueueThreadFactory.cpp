@@ -7,21 +7,69 @@
 
 namespace react::uwp {
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread() noexcept {
-  return std::make_shared<Mso::React::MessageDispatchQueue>(Mso::DispatchQueue::MakeLooperQueue(), nullptr, nullptr);
+namespace {
+
+struct QueueStatsObserver : Mso::UnknownObject<Mso::IDispatchTaskObserver> {
+  QueueStatsObserver(std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept : m_stats{stats} {}
+
+  void OnTaskPosted() noexcept override {
+    m_stats->RecordPost();
+  }
+
+  void OnTaskInvoked(
+      std::chrono::steady_clock::duration waitTime,
+      std::chrono::steady_clock::duration runTime) noexcept override {
+    m_stats->RecordTask(waitTime, runTime);
+  }
+
+  void OnTaskCanceled() noexcept override {
+    m_stats->RecordCancel();
+  }
+
+ private:
+  const std::shared_ptr<facebook::react::QueueStats> m_stats;
+};
+
+std::shared_ptr<facebook::react::MessageQueueThread> MakeObservedQueueThread(
+    Mso::DispatchQueue const &queue,
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  ObserveQueueStats(queue, stats);
+  return std::make_shared<Mso::React::MessageDispatchQueue>(queue, nullptr, nullptr);
+}
+
+} // namespace
+
+void ObserveQueueStats(
+    Mso::DispatchQueue const &queue,
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  if (stats) {
+    VerifyElseCrashSz(
+        queue.SetTaskObserver(Mso::Make<QueueStatsObserver, Mso::IDispatchTaskObserver>(stats)),
+        "The queue already has a task observer");
+  }
+}
+
+std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  return MakeObservedQueueThread(Mso::DispatchQueue::MakeLooperQueue(), stats);
 }
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcept {
-  return std::make_shared<Mso::React::MessageDispatchQueue>(Mso::DispatchQueue::MainUIQueue(), nullptr, nullptr);
+std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  // The MainUIQueue is shared by all instances: the stats are given to the MessageDispatchQueue
+  // instead of observing the dispatch queue, so that they do not record the tasks of the others.
+  return std::make_shared<Mso::React::MessageDispatchQueue>(Mso::DispatchQueue::MainUIQueue(), nullptr, nullptr, stats);
 }
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeSerialQueueThread() noexcept {
-  return std::make_shared<Mso::React::MessageDispatchQueue>(Mso::DispatchQueue{}, nullptr, nullptr);
+std::shared_ptr<facebook::react::MessageQueueThread> MakeSerialQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  return MakeObservedQueueThread(Mso::DispatchQueue{}, stats);
 }
 
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept {
-  return std::make_shared<BatchingQueueThread>(queueThread);
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept {
+  return std::make_shared<BatchingQueueThread>(queueThread, stats);
 }
 
 } // namespace react::uwp
@@ -4,17 +4,31 @@
 #pragma once
 
 #include <ReactWindowsCore/BatchingMessageQueueThread.h>
+#include <ReactWindowsCore/QueueStats.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <dispatchQueue/dispatchQueue.h>
 
 namespace react::uwp {
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread() noexcept;
+// Records the tasks of a queue owned by the caller into the optional stats, including the tasks posted to the
+// DispatchQueue directly. A queue has at most one task observer.
+void ObserveQueueStats(
+    Mso::DispatchQueue const &queue,
+    std::shared_ptr<facebook::react::QueueStats> const &stats) noexcept;
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcept;
+// The queues record the wait and run time of their tasks into the optional stats.
 
-std::shared_ptr<facebook::react::MessageQueueThread> MakeSerialQueueThread() noexcept;
+std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats = nullptr) noexcept;
+
+std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats = nullptr) noexcept;
+
+std::shared_ptr<facebook::react::MessageQueueThread> MakeSerialQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> const &stats = nullptr) noexcept;
 
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::shared_ptr<facebook::react::QueueStats> const &stats = nullptr) noexcept;
 
 } // namespace react::uwp
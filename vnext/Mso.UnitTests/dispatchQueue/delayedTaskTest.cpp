@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+using namespace std::chrono_literals;
+
+namespace DelayedTaskTests {
+
+TEST_CLASS_EX (DelayedTaskTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(PostDelayed_RunsAfterDelay) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::ManualResetEvent ran;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point runTime;
+    auto delayedTask = queue.PostDelayed(
+        [&]() noexcept {
+          runTime = std::chrono::steady_clock::now();
+          ran.Set();
+        },
+        30ms);
+
+    TestCheck(static_cast<bool>(delayedTask));
+    ran.Wait();
+    TestCheck(runTime - start >= 30ms);
+    TestCheck(!delayedTask.Cancel());
+  }
+
+  TEST_METHOD(PostAt_RunsInDueTimeOrder) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::ManualResetEvent allRan;
+    std::vector<int> order;
+    auto now = std::chrono::steady_clock::now();
+    for (int i : {3, 1, 4, 0, 2}) {
+      queue.PostAt(
+          [&, i]() noexcept {
+            order.push_back(i);
+            if (order.size() == 5) {
+              allRan.Set();
+            }
+          },
+          now + std::chrono::milliseconds(10 + 15 * i));
+    }
+
+    allRan.Wait();
+    TestCheck((order == std::vector<int>{0, 1, 2, 3, 4}));
+  }
+
+  TEST_METHOD(PostAt_PastDueTimePostsImmediately) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::ManualResetEvent ran;
+    auto delayedTask = queue.PostAt([&]() noexcept { ran.Set(); }, std::chrono::steady_clock::now() - 1s);
+    ran.Wait();
+    TestCheck(!delayedTask.Cancel());
+  }
+
+  TEST_METHOD(Cancel_CallsOnCancel) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::atomic<bool> isInvoked{false};
+    std::atomic<bool> isCanceled{false};
+    auto delayedTask = queue.PostDelayed(
+        Mso::MakeDispatchTask([&]() noexcept { isInvoked = true; }, [&]() noexcept { isCanceled = true; }), 1h);
+
+    TestCheck(delayedTask.Cancel());
+    TestCheck(isCanceled.load());
+    TestCheck(!delayedTask.Cancel());
+    TestCheck(!isInvoked.load());
+  }
+
+  TEST_METHOD(Cancel_OnlyCancelsItsTask) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::ManualResetEvent ran;
+    std::atomic<int32_t> runCount{0};
+    auto canceledTask = queue.PostDelayed([&]() noexcept { ++runCount; }, 20ms);
+    queue.PostDelayed(
+        [&]() noexcept {
+          ++runCount;
+          ran.Set();
+        },
+        40ms);
+
+    TestCheck(canceledTask.Cancel());
+    ran.Wait();
+    TestCheckEqual(1, runCount.load());
+  }
+
+  TEST_METHOD(ShutdownQueue_CancelsDueTask) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::ManualResetEvent canceled;
+    queue.PostDelayed(Mso::MakeDispatchTask([]() noexcept {}, [&]() noexcept { canceled.Set(); }), 10ms);
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    canceled.Wait();
+  }
+
+  TEST_METHOD(DestroyedQueue_CancelsDueTask) {
+    Mso::ManualResetEvent canceled;
+    std::atomic<bool> isInvoked{false};
+    {
+      // The pending task does not keep the queue alive.
+      auto queue = Mso::DispatchQueue::MakeSerialQueue();
+      queue.PostDelayed(
+          Mso::MakeDispatchTask([&]() noexcept { isInvoked = true; }, [&]() noexcept { canceled.Set(); }), 10ms);
+    }
+
+    canceled.Wait();
+    TestCheck(!isInvoked.load());
+  }
+
+  TEST_METHOD(ManyTimers_ShareOneWheel) {
+    // Timers with different delays land in different levels of the timer wheel.
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(0);
+    Mso::ManualResetEvent allRan;
+    std::atomic<int32_t> ranCount{0};
+    std::vector<Mso::DispatchDelayedTask> longTimers;
+    for (int i = 0; i < 1000; ++i) {
+      queue.PostDelayed(
+          [&]() noexcept {
+            if (++ranCount == 1000) {
+              allRan.Set();
+            }
+          },
+          std::chrono::milliseconds(i % 100));
+      longTimers.push_back(queue.PostDelayed([]() noexcept {}, std::chrono::minutes(1 + i)));
+    }
+
+    allRan.Wait();
+    for (auto &longTimer : longTimers) {
+      TestCheck(longTimer.Cancel());
+    }
+  }
+};
+
+} // namespace DelayedTaskTests
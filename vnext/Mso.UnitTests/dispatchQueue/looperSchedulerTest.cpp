@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+namespace LooperSchedulerTests {
+
+namespace {
+
+// Bounces a task between two queues until it made hopCount hops.
+struct PingPong {
+  PingPong(Mso::DispatchQueue const &ping, Mso::DispatchQueue const &pong, size_t hopCount) noexcept
+      : m_queues{ping, pong}, m_hopCount{hopCount} {}
+
+  // Runs the hops and returns the average time per hop in nanoseconds.
+  double Run() noexcept {
+    auto start = std::chrono::steady_clock::now();
+    Hop(0);
+    m_done.Wait();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / m_hopCount;
+  }
+
+  size_t HopCount() const noexcept {
+    return m_hops.load();
+  }
+
+ private:
+  void Hop(size_t index) noexcept {
+    m_queues[index % 2].Post([this, index]() noexcept {
+      m_hops.fetch_add(1);
+      if (index + 1 < m_hopCount) {
+        Hop(index + 1);
+      } else {
+        m_done.Set();
+      }
+    });
+  }
+
+ private:
+  Mso::DispatchQueue m_queues[2];
+  const size_t m_hopCount;
+  std::atomic<size_t> m_hops{0};
+  Mso::ManualResetEvent m_done;
+};
+
+// Posts taskCount tasks from one thread and waits until all of them ran.
+// Returns the average time per task in nanoseconds.
+double PostBurst(Mso::DispatchQueue const &queue, size_t taskCount) noexcept {
+  Mso::ManualResetEvent allRan;
+  std::atomic<size_t> ranCount{0};
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < taskCount; ++i) {
+    queue.Post([&]() noexcept {
+      if (++ranCount == taskCount) {
+        allRan.Set();
+      }
+    });
+  }
+
+  allRan.Wait();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / taskCount;
+}
+
+} // namespace
+
+TEST_CLASS_EX (LooperSchedulerTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(LooperQueue_PingPong) {
+    auto ping = Mso::DispatchQueue::MakeLooperQueue();
+    auto pong = Mso::DispatchQueue::MakeLooperQueue();
+    PingPong pingPong{ping, pong, 10000};
+    pingPong.Run();
+    TestCheckEqual(10000u, pingPong.HopCount());
+  }
+
+  TEST_METHOD(LooperQueue_RunsTasksPostedFromManyThreads) {
+    // Tasks are posted while the looper thread runs, waits, and is about to wait.
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    Mso::ManualResetEvent allRan;
+    std::atomic<int> ranCount{0};
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < 4; ++producer) {
+      producers.emplace_back([&]() noexcept {
+        for (int i = 0; i < 5000; ++i) {
+          queue.Post([&]() noexcept {
+            if (++ranCount == 20000) {
+              allRan.Set();
+            }
+          });
+
+          if (i % 100 == 0) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    allRan.Wait();
+    TestCheckEqual(20000, ranCount.load());
+  }
+
+  TEST_METHOD(LooperQueue_ShutdownWakesUpIdleLooper) {
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    Mso::ManualResetEvent ran;
+    queue.Post([&]() noexcept { ran.Set(); });
+    ran.Wait();
+
+    // Let the looper thread go to wait before the shutdown.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(Benchmark_LooperQueue) {
+    auto ping = Mso::DispatchQueue::MakeLooperQueue();
+    auto pong = Mso::DispatchQueue::MakeLooperQueue();
+    double hopNs = PingPong{ping, pong, 100000}.Run();
+
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    double burstNs = PostBurst(queue, 1000000);
+
+    TestAssert::CommentEx(
+        L"Looper queue: ping-pong %.1f ns/hop, burst %.1f ns/task (%.0f tasks/s)", hopNs, burstNs, 1e9 / burstNs);
+  }
+};
+
+} // namespace LooperSchedulerTests
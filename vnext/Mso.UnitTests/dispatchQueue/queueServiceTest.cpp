@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+namespace QueueServiceTests {
+
+namespace {
+
+// Posts tasksPerProducer tasks from each producer thread and waits until all of them ran.
+// Returns the average time per task in nanoseconds.
+double PostFromProducers(Mso::DispatchQueue const &queue, size_t producerCount, size_t tasksPerProducer) noexcept {
+  const size_t taskCount = producerCount * tasksPerProducer;
+  std::atomic<size_t> ranCount{0};
+  Mso::ManualResetEvent allRan;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < producerCount; ++i) {
+    producers.emplace_back([&]() noexcept {
+      for (size_t j = 0; j < tasksPerProducer; ++j) {
+        queue.Post([&]() noexcept {
+          if (++ranCount == taskCount) {
+            allRan.Set();
+          }
+        });
+      }
+    });
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  allRan.Wait();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / taskCount;
+}
+
+struct TestTaskObserver : Mso::UnknownObject<Mso::IDispatchTaskObserver> {
+  void OnTaskPosted() noexcept override {
+    ++PostedCount;
+  }
+
+  void OnTaskInvoked(
+      std::chrono::steady_clock::duration waitTime,
+      std::chrono::steady_clock::duration runTime) noexcept override {
+    ++InvokedCount;
+    MaxWaitTime = std::max(MaxWaitTime, waitTime);
+    MaxRunTime = std::max(MaxRunTime, runTime);
+  }
+
+  void OnTaskCanceled() noexcept override {
+    ++CanceledCount;
+  }
+
+  std::atomic<int> PostedCount{0};
+  std::atomic<int> InvokedCount{0};
+  std::atomic<int> CanceledCount{0};
+  std::chrono::steady_clock::duration MaxWaitTime{0}; // Only changed on the queue.
+  std::chrono::steady_clock::duration MaxRunTime{0};
+};
+
+} // namespace
+
+TEST_CLASS_EX (QueueServiceTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(SerialQueue_KeepsOrderOfEachProducer) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    constexpr size_t producerCount{4};
+    constexpr size_t tasksPerProducer{5000};
+    std::vector<size_t> lastSeen(producerCount, 0);
+    std::atomic<bool> isOrdered{true};
+    std::atomic<size_t> ranCount{0};
+    Mso::ManualResetEvent allRan;
+
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < producerCount; ++i) {
+      producers.emplace_back([&, i]() noexcept {
+        for (size_t j = 1; j <= tasksPerProducer; ++j) {
+          queue.Post([&, i, j]() noexcept {
+            // Serial queue: only one task accesses lastSeen at a time.
+            if (lastSeen[i] + 1 != j) {
+              isOrdered = false;
+            }
+            lastSeen[i] = j;
+            if (++ranCount == producerCount * tasksPerProducer) {
+              allRan.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    allRan.Wait();
+    TestCheck(isOrdered.load());
+  }
+
+  TEST_METHOD(SerialQueue_OverflowKeepsOrder) {
+    // While the queue is suspended, tasks pile up well past the lock-free ring buffer.
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::vector<int> order;
+    Mso::ManualResetEvent allRan;
+    {
+      auto suspend = queue.Suspend();
+      for (int i = 0; i < 5000; ++i) {
+        queue.Post([&, i]() noexcept {
+          order.push_back(i);
+          if (i == 4999) {
+            allRan.Set();
+          }
+        });
+      }
+    }
+
+    allRan.Wait();
+    TestCheckEqual(5000u, order.size());
+    for (int i = 0; i < 5000; ++i) {
+      TestCheckEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(SerialQueue_ShutdownCancelsPendingTasks) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::atomic<int> invokeCount{0};
+    std::atomic<int> cancelCount{0};
+    {
+      auto suspend = queue.Suspend();
+      for (int i = 0; i < 2000; ++i) {
+        queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+      }
+
+      queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    }
+
+    // Posted after the shutdown.
+    queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+    queue.AwaitTermination();
+
+    TestCheckEqual(0, invokeCount.load());
+    TestCheckEqual(2001, cancelCount.load());
+  }
+
+  TEST_METHOD(SerialQueue_TaskObserverSeesWaitAndRunTime) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto observer = Mso::Make<TestTaskObserver>();
+    TestCheck(queue.SetTaskObserver(Mso::CntPtr<Mso::IDispatchTaskObserver>{observer}));
+
+    Mso::ManualResetEvent ran;
+    {
+      auto suspend = queue.Suspend();
+      queue.Post([]() noexcept { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+      queue.Post(Mso::MakeDispatchTask([]() noexcept {}, []() noexcept {}));
+      queue.Post([&]() noexcept { ran.Set(); });
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ran.Wait();
+    TestCheckEqual(3, observer->PostedCount.load());
+    TestCheckEqual(3, observer->InvokedCount.load());
+    TestCheck(observer->MaxWaitTime >= std::chrono::milliseconds(10));
+    TestCheck(observer->MaxRunTime >= std::chrono::milliseconds(20));
+
+    // Tasks posted after shutdown.
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    queue.Post([]() noexcept {});
+    queue.AwaitTermination();
+    TestCheckEqual(4, observer->PostedCount.load());
+    TestCheckEqual(1, observer->CanceledCount.load());
+  }
+
+  TEST_METHOD(SerialQueue_TaskObserverIsNotReplaced) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto first = Mso::Make<TestTaskObserver>();
+    auto second = Mso::Make<TestTaskObserver>();
+    TestCheck(queue.SetTaskObserver(Mso::CntPtr<Mso::IDispatchTaskObserver>{first}));
+    TestCheck(queue.SetTaskObserver(Mso::CntPtr<Mso::IDispatchTaskObserver>{first}));
+    TestCheck(!queue.SetTaskObserver(Mso::CntPtr<Mso::IDispatchTaskObserver>{second}));
+
+    Mso::ManualResetEvent ran;
+    queue.Post([&]() noexcept { ran.Set(); });
+    ran.Wait();
+    TestCheckEqual(1, first->PostedCount.load());
+    TestCheckEqual(0, second->PostedCount.load());
+  }
+
+  TEST_METHOD(ConcurrentQueue_RunsAllTasks) {
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(4);
+    PostFromProducers(queue, 8, 2000);
+  }
+
+  TEST_METHOD(Benchmark_PostContention) {
+    constexpr size_t tasksPerProducer{50000};
+    for (size_t producerCount : {1, 4, 16}) {
+      auto serialQueue = Mso::DispatchQueue::MakeSerialQueue();
+      double serialNs = PostFromProducers(serialQueue, producerCount, tasksPerProducer);
+
+      auto concurrentQueue = Mso::DispatchQueue::MakeConcurrentQueue(0);
+      double concurrentNs = PostFromProducers(concurrentQueue, producerCount, tasksPerProducer);
+
+      TestAssert::CommentEx(
+          L"%zu producers: serial queue %.1f ns/task, concurrent queue %.1f ns/task",
+          producerCount,
+          serialNs,
+          concurrentNs);
+    }
+  }
+};
+
+} // namespace QueueServiceTests
@@ -0,0 +1,155 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+namespace ThreadPoolSchedulerTests {
+
+namespace {
+
+// Each task posts two child tasks until the tree has the given depth.
+// Returns the elapsed time in milliseconds.
+double RunTaskTree(Mso::DispatchQueue const &queue, uint32_t depth) noexcept {
+  const size_t taskCount = (size_t{1} << (depth + 1)) - 1;
+  std::atomic<size_t> ranCount{0};
+  Mso::ManualResetEvent allRan;
+
+  std::function<void(uint32_t)> postTask = [&](uint32_t level) noexcept {
+    queue.Post([&, level]() noexcept {
+      if (level < depth) {
+        postTask(level + 1);
+        postTask(level + 1);
+      }
+
+      if (++ranCount == taskCount) {
+        allRan.Set();
+      }
+    });
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  postTask(0);
+  allRan.Wait();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_CLASS_EX (ThreadPoolSchedulerTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(WorkStealingQueue_SerialRunsInOrder) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(1);
+    TestCheck(queue.IsSerial());
+
+    std::vector<int> order;
+    Mso::ManualResetEvent allRan;
+    for (int i = 0; i < 1000; ++i) {
+      queue.Post([&, i]() noexcept {
+        TestCheck(queue.HasThreadAccess());
+        order.push_back(i);
+        if (i == 999) {
+          allRan.Set();
+        }
+      });
+    }
+
+    allRan.Wait();
+    for (int i = 0; i < 1000; ++i) {
+      TestCheckEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(WorkStealingQueue_LimitsConcurrency) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(2);
+    TestCheck(!queue.IsSerial());
+
+    std::atomic<int32_t> runningCount{0};
+    std::atomic<int32_t> maxRunningCount{0};
+    std::atomic<int32_t> ranCount{0};
+    Mso::ManualResetEvent allRan;
+    for (int i = 0; i < 100; ++i) {
+      queue.Post([&]() noexcept {
+        int32_t running = ++runningCount;
+        int32_t maxRunning = maxRunningCount.load();
+        while (running > maxRunning && !maxRunningCount.compare_exchange_weak(maxRunning, running)) {
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        --runningCount;
+        if (++ranCount == 100) {
+          allRan.Set();
+        }
+      });
+    }
+
+    allRan.Wait();
+    TestCheck(maxRunningCount.load() <= 2);
+  }
+
+  TEST_METHOD(WorkStealingQueue_RunsTasksPostedFromTasks) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(0);
+    RunTaskTree(queue, 10);
+  }
+
+  TEST_METHOD(WorkStealingQueue_AddsThreadsForBlockedTasks) {
+    // The tasks wait for each other, and there are more of them than the pool starts with threads.
+    // They can only all finish if the pool adds threads.
+    const int32_t taskCount = static_cast<int32_t>(std::max(2u, std::thread::hardware_concurrency())) + 2;
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(static_cast<uint32_t>(taskCount));
+
+    std::mutex mutex;
+    std::condition_variable allStarted;
+    int32_t startedCount{0};
+    std::atomic<int32_t> finishedCount{0};
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&]() noexcept {
+        std::unique_lock lock{mutex};
+        if (++startedCount == taskCount) {
+          allStarted.notify_all();
+        }
+
+        auto isAllStarted = [&]() noexcept { return startedCount == taskCount; };
+        if (allStarted.wait_for(lock, std::chrono::seconds{30}, isAllStarted)) {
+          ++finishedCount;
+        }
+      });
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(taskCount, finishedCount.load());
+  }
+
+  TEST_METHOD(WorkStealingQueue_ShutdownCompletesPendingTasks) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(4);
+    std::atomic<int32_t> ranCount{0};
+    for (int i = 0; i < 1000; ++i) {
+      queue.Post([&]() noexcept { ++ranCount; });
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(1000, ranCount.load());
+  }
+
+  TEST_METHOD(Benchmark_TaskTree) {
+    constexpr uint32_t depth{16};
+    double platformMs = RunTaskTree(Mso::DispatchQueue::MakeConcurrentQueue(0), depth);
+    double workStealingMs = RunTaskTree(Mso::DispatchQueue::MakeWorkStealingQueue(0), depth);
+    TestAssert::CommentEx(
+        L"%zu tasks: platform thread pool %.1f ms, work-stealing thread pool %.1f ms",
+        (size_t{1} << (depth + 1)) - 1,
+        platformMs,
+        workStealingMs);
+  }
+};
+
+} // namespace ThreadPoolSchedulerTests
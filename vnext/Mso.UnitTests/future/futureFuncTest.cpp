@@ -108,6 +108,29 @@ TEST_CLASS_EX (FutureFuncTest, LibletAwareMemLeakDetection) {
     TestCheckEqual(4, result.size());
     TestCheckEqual(2, result[1]);
   }
+
+  TEST_METHOD(PostFutureDelayed) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto start = std::chrono::steady_clock::now();
+    auto future = Mso::PostFutureDelayed(queue, std::chrono::milliseconds(20), [&queue]() noexcept {
+      TestCheck(queue.IsCurrentQueue());
+      return 5;
+    });
+
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(future));
+    TestCheck(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+  }
+
+  TEST_METHOD(PostFutureDelayed_ShutdownQueue) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    auto future = Mso::PostFutureDelayed(queue, std::chrono::milliseconds(1), []() noexcept { return 5; });
+
+    auto result = Mso::FutureWait(future);
+    TestCheck(result.IsError());
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(result.GetError()));
+  }
+
 // TODO: implement Mso::PotsTimer and Mso::WhenDoneOrTimeout
 #if 0
   TEST_METHOD(WhenDoneOrTimeout_TimeOut_int) {
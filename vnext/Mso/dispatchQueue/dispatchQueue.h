@@ -5,6 +5,7 @@
 #ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 #define MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 
+#include <chrono>
 #include <optional>
 #include <thread>
 #include "functional/functor.h"
@@ -20,6 +21,7 @@ namespace Mso {
 using DispatchTask = VoidFunctor;
 
 // Forward declarations
+struct DispatchDelayedTask;
 struct DispatchLocalValueGuard;
 struct DispatchQueue;
 struct DispatchSuspendGuard;
@@ -29,10 +31,12 @@ struct DispatchTaskImpl;
 template <typename TInvoke>
 struct DispatchCleanupTaskImpl;
 struct ICancellationListener;
+struct IDispatchDelayedTask;
 struct IDispatchQueue;
 struct IDispatchQueueScheduler;
 struct IDispatchQueueService;
 struct IDispatchQueueStatic;
+struct IDispatchTaskObserver;
 
 //! A reason for a task being invoked to yield.
 enum class TaskYieldReason {
@@ -137,6 +141,11 @@ struct DispatchQueue {
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   static DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept;
 
+  //! Create a queue on top of the portable work-stealing thread pool that uses up to maxThreads threads.
+  //! The maxThreads has the same meaning as in MakeConcurrentQueue. On POSIX platforms the other queues
+  //! use this thread pool too.
+  static DispatchQueue MakeWorkStealingQueue(uint32_t maxThreads) noexcept;
+
   //! True if state is not empty.
   explicit operator bool() const noexcept;
 
@@ -152,6 +161,15 @@ struct DispatchQueue {
   //! Otherwise, post it for the asynchronous invocation.
   void DeferElsePost(DispatchTask &&task) const noexcept;
 
+  //! Post the task to the end of the queue after the delay.
+  //! The returned DispatchDelayedTask can cancel the task until it is due. The pending task does not keep the queue
+  //! alive: if the queue is shut down or destroyed when the task is due, then the task is canceled.
+  DispatchDelayedTask PostDelayed(DispatchTask &&task, std::chrono::steady_clock::duration delay) const noexcept;
+
+  //! Post the task to the end of the queue at the due time. The task is posted immediately if it is already due.
+  //! The returned DispatchDelayedTask can cancel the task until it is due.
+  DispatchDelayedTask PostAt(DispatchTask &&task, std::chrono::steady_clock::time_point dueTime) const noexcept;
+
   //! True if current task is invoked in context of this dispatch queue.
   bool IsCurrentQueue() const noexcept;
 
@@ -190,6 +208,12 @@ struct DispatchQueue {
   //! Waits until all pending tasks are completed after shutdown.
   void AwaitTermination() const noexcept;
 
+  //! Set the observer that is told about each task posted to the queue, and about its wait and run time.
+  //! Tasks posted before the call are not observed. The observer is kept until the queue is destroyed.
+  //! Returns false without replacing it if the queue already has a different observer.
+  //! Without an observer the queue does not read the clock for its tasks.
+  bool SetTaskObserver(Mso::CntPtr<IDispatchTaskObserver> &&observer) const noexcept;
+
   //! True if the other dispatch queue has the same state pointer.
   [[nodiscard]] bool operator==(DispatchQueue const &other) const noexcept;
 
@@ -283,6 +307,31 @@ struct DispatchTaskBatch {
   Mso::CntPtr<IDispatchQueueService> m_state;
 };
 
+//! Handle to a task posted with DispatchQueue::PostDelayed or DispatchQueue::PostAt.
+//! DispatchDelayedTask is just a shared pointer to internal state and has size of a pointer. It is OK to copy and
+//! move.
+struct DispatchDelayedTask {
+  //! Create empty DispatchDelayedTask.
+  DispatchDelayedTask(std::nullptr_t = nullptr) noexcept;
+
+  //! Create new DispatchDelayedTask with provided state.
+  DispatchDelayedTask(Mso::CntPtr<IDispatchDelayedTask> &&state) noexcept;
+
+  //! True if state is not empty.
+  explicit operator bool() const noexcept;
+
+  //! Cancel the task if it is not due yet. The task is canceled the same way as the dispatch queue cancels tasks.
+  //! Returns false if the task is already posted to the queue or canceled.
+  bool Cancel() const noexcept;
+
+  //! A 'back-door' to get pointer to the state pointer. I.e. IDispatchDelayedTask**.
+  template <typename TObject>
+  friend auto GetRawState(TObject &&obj) noexcept;
+
+ private:
+  Mso::CntPtr<IDispatchDelayedTask> m_state;
+};
+
 //! A dispatch queue task. The task can be either invoked or canceled.
 MSO_GUID(ICancellationListener, "ec0f1ee4-b72d-4f50-8ba2-3131aeeb3663")
 struct ICancellationListener : IUnknown {
@@ -290,6 +339,28 @@ struct ICancellationListener : IUnknown {
   virtual void OnCancel() noexcept = 0;
 };
 
+//! A task that is posted to a dispatch queue when it is due.
+MSO_GUID(IDispatchDelayedTask, "c275eca9-d895-4515-9c6e-3fce6da384dc")
+struct IDispatchDelayedTask : IUnknown {
+  //! Cancel the task if it is not due yet. Returns true if the task is canceled.
+  virtual bool Cancel() noexcept = 0;
+};
+
+//! Observes the tasks posted to a dispatch queue. The methods are called on the posting and the invoking threads.
+MSO_GUID(IDispatchTaskObserver, "8d0f9a3e-51c2-4b7e-9f64-2a3c7e1b5d08")
+struct IDispatchTaskObserver : IUnknown {
+  //! A task is posted to the queue.
+  virtual void OnTaskPosted() noexcept = 0;
+
+  //! A posted task was invoked after waiting in the queue for waitTime.
+  virtual void OnTaskInvoked(
+      std::chrono::steady_clock::duration waitTime,
+      std::chrono::steady_clock::duration runTime) noexcept = 0;
+
+  //! A posted task is canceled.
+  virtual void OnTaskCanceled() noexcept = 0;
+};
+
 //! Simple dispatch queue interface that posts tasks for asynchronous invocation.
 MSO_GUID(IDispatchQueue, "45b16d36-d4d7-4fe2-8af0-626bc39e1d3b")
 struct IDispatchQueue : IUnknown {
@@ -336,6 +407,10 @@ struct IDispatchQueueService : IUnknown {
   //! Otherwise, post it for the asynchronous invocation.
   virtual void DeferElsePost(DispatchTask &&task) noexcept = 0;
 
+  //! Add task to the end of asynchronous queue when the due time comes. The task is not batched.
+  //! Returns a handle that can cancel the task until it is due.
+  virtual DispatchDelayedTask PostAt(DispatchTask &&task, std::chrono::steady_clock::time_point dueTime) noexcept = 0;
+
   //! True if current task is invoked in context of this dispatch queue.
   virtual bool IsCurrentQueue() noexcept = 0;
 
@@ -400,6 +475,9 @@ struct IDispatchQueueService : IUnknown {
 
   //! Calls ICancellationListener::OnCancel in case if task implements the ICancellationListener interface.
   virtual void CancelTask(DispatchTask &&task) noexcept = 0;
+
+  //! Set the observer for the tasks posted after the call. Returns false if a different observer is already set.
+  virtual bool SetTaskObserver(Mso::CntPtr<IDispatchTaskObserver> &&observer) noexcept = 0;
 };
 
 //! The interface for dispatch queue static members.
@@ -439,6 +517,11 @@ struct IDispatchQueueStatic : IUnknown {
   //! Create a dispatch queue on top of custom IDispatchQueueScheduler.
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   virtual DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept = 0;
+
+  //! Create a queue on top of the portable work-stealing thread pool that uses up to maxThreads threads.
+  //! The maxThreads has the same meaning as in MakeConcurrentQueue. On POSIX platforms the other queues
+  //! use this thread pool too.
+  virtual DispatchQueue MakeWorkStealingQueue(uint32_t maxThreads) noexcept = 0;
 };
 
 //! DispatchTask implementation based on invoke and cancel function objects.
@@ -570,6 +653,10 @@ inline /*static*/ DispatchQueue DispatchQueue::MakeCustomQueue(
   return IDispatchQueueStatic::Instance()->MakeCustomQueue(std::move(scheduler));
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeWorkStealingQueue(uint32_t maxThreads) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeWorkStealingQueue(maxThreads);
+}
+
 inline DispatchQueue::operator bool() const noexcept {
   return m_state != nullptr;
 }
@@ -586,6 +673,18 @@ inline void DispatchQueue::DeferElsePost(DispatchTask &&task) const noexcept {
   m_state->DeferElsePost(std::move(task));
 }
 
+inline DispatchDelayedTask DispatchQueue::PostDelayed(
+    DispatchTask &&task,
+    std::chrono::steady_clock::duration delay) const noexcept {
+  return m_state->PostAt(std::move(task), std::chrono::steady_clock::now() + delay);
+}
+
+inline DispatchDelayedTask DispatchQueue::PostAt(
+    DispatchTask &&task,
+    std::chrono::steady_clock::time_point dueTime) const noexcept {
+  return m_state->PostAt(std::move(task), dueTime);
+}
+
 inline bool DispatchQueue::IsCurrentQueue() const noexcept {
   return m_state->IsCurrentQueue();
 }
@@ -627,6 +726,10 @@ inline void DispatchQueue::AwaitTermination() const noexcept {
   m_state->AwaitTermination();
 }
 
+inline bool DispatchQueue::SetTaskObserver(Mso::CntPtr<IDispatchTaskObserver> &&observer) const noexcept {
+  return m_state->SetTaskObserver(std::move(observer));
+}
+
 inline bool DispatchQueue::operator==(DispatchQueue const &other) const noexcept {
   return m_state.Get() == other.m_state.Get();
 }
@@ -715,6 +818,23 @@ inline void DispatchTaskBatch::Cancel() noexcept {
   }
 }
 
+//=============================================================================
+// DispatchDelayedTask inline implementation
+//=============================================================================
+
+inline DispatchDelayedTask::DispatchDelayedTask(std::nullptr_t) noexcept {}
+
+inline DispatchDelayedTask::DispatchDelayedTask(Mso::CntPtr<IDispatchDelayedTask> &&state) noexcept
+    : m_state{std::move(state)} {}
+
+inline DispatchDelayedTask::operator bool() const noexcept {
+  return m_state != nullptr;
+}
+
+inline bool DispatchDelayedTask::Cancel() const noexcept {
+  return m_state && m_state->Cancel();
+}
+
 //=============================================================================
 // DispatchTaskImpl inline implementation
 //=============================================================================
@@ -155,6 +155,21 @@ auto PostFuture(TExecutor &&executor, TCallback &&callback) noexcept {
   return typename ExecutorTraits::template FutureType<ValueType>(std::move(future));
 }
 
+template <class TCallback>
+auto PostFutureDelayed(
+    DispatchQueue const &queue,
+    std::chrono::steady_clock::duration delay,
+    TCallback &&callback) noexcept {
+  // The delayed task completes the promise in the queue, and the inline continuation runs there too.
+  Mso::Promise<void> promise;
+  auto future = promise.AsFuture().Then(Mso::Executors::Inline{}, std::forward<TCallback>(callback));
+  queue.PostDelayed(
+      Mso::MakeDispatchTask(
+          [promise]() noexcept { promise.SetValue(); }, [promise]() noexcept { promise.TryCancel(); }),
+      delay);
+  return future;
+}
+
 } // namespace Mso
 
 #endif // MSO_FUTURE_DETAILS_FUTUREFUNCINL_H
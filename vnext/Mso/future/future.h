@@ -77,6 +77,14 @@ auto PostFuture(TCallback &&callback) noexcept;
 template <class TExecutor, class TCallback>
 auto PostFuture(TExecutor &&executor, TCallback &&callback) noexcept;
 
+//! Create an instance of a future based on a callback, and post it to the queue after the delay.
+//! If the queue cancels the callback, then the future fails with a cancellation error.
+template <class TCallback>
+auto PostFutureDelayed(
+    DispatchQueue const &queue,
+    std::chrono::steady_clock::duration delay,
+    TCallback &&callback) noexcept;
+
 //! Create an instance of completed Mso::Future<T> from a provided value.
 template <class T>
 auto MakeCompletedFuture(T &&value) noexcept;
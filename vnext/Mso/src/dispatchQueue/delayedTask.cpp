@@ -0,0 +1,207 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "delayedTask.h"
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace Mso {
+
+//=============================================================================
+// DelayedTask implementation
+//=============================================================================
+
+DelayedTask::DelayedTask(Mso::WeakPtr<IDispatchQueueService> &&queue, DispatchTask &&task) noexcept
+    : m_queue{std::move(queue)}, m_task{std::move(task)} {
+  m_entry.Task = this;
+}
+
+void DelayedTask::Post() noexcept {
+  if (auto queue = m_queue.GetStrongPtr()) {
+    queue->Post(std::move(m_task));
+  } else {
+    CancelTask();
+  }
+}
+
+void DelayedTask::CancelTask() noexcept {
+  DispatchTask task{std::move(m_task)};
+  if (auto queue = m_queue.GetStrongPtr()) {
+    queue->CancelTask(std::move(task));
+  } else if (auto cancellation = query_cast<ICancellationListener *>(task.Get())) {
+    cancellation->OnCancel();
+  }
+}
+
+bool DelayedTask::Cancel() noexcept {
+  return DelayedTaskScheduler::Instance().Cancel(*this);
+}
+
+//=============================================================================
+// DelayedTaskScheduler implementation
+//=============================================================================
+
+/*static*/ DelayedTaskScheduler &DelayedTaskScheduler::Instance() noexcept {
+  // The scheduler is never destroyed: its tasks may be canceled or due at any time.
+  static DelayedTaskScheduler *instance{new DelayedTaskScheduler()};
+  return *instance;
+}
+
+#if defined(MS_TARGET_POSIX)
+DelayedTaskScheduler::DelayedTaskScheduler() noexcept : m_thread{[this]() noexcept { Run(); }} {}
+#else
+DelayedTaskScheduler::DelayedTaskScheduler() noexcept
+    : m_timer{::CreateThreadpoolTimer(TimerCallback, this, nullptr)} {
+  VerifyElseCrashSz(m_timer, "Cannot create the thread pool timer");
+}
+#endif
+
+DispatchDelayedTask DelayedTaskScheduler::Schedule(
+    Mso::WeakPtr<IDispatchQueueService> &&queue,
+    DispatchTask &&task,
+    TimePoint dueTime) noexcept {
+  auto delayedTask = Mso::Make<DelayedTask>(std::move(queue), std::move(task));
+  bool isScheduled{false};
+  bool shouldWakeUp{false};
+
+  {
+    std::lock_guard lock{m_mutex};
+    delayedTask->m_entry.DueTick = ToDueTick(dueTime);
+    if (m_wheel.Insert(&delayedTask->m_entry)) {
+      Mso::CntPtr<DelayedTask>{delayedTask}.Detach(); // The wheel holds a reference.
+      isScheduled = true;
+      shouldWakeUp = delayedTask->m_entry.DueTick < m_wakeUpTick;
+#if !defined(MS_TARGET_POSIX)
+      if (shouldWakeUp) {
+        SetTimer(delayedTask->m_entry.DueTick);
+      }
+#endif
+    }
+  }
+
+  if (!isScheduled) {
+    delayedTask->Post();
+    return nullptr;
+  }
+
+#if defined(MS_TARGET_POSIX)
+  if (shouldWakeUp) {
+    m_wakeUp.notify_one();
+  }
+#endif
+
+  return Mso::CntPtr<IDispatchDelayedTask>{std::move(delayedTask)};
+}
+
+bool DelayedTaskScheduler::Cancel(DelayedTask &delayedTask) noexcept {
+  {
+    std::lock_guard lock{m_mutex};
+    if (!m_wheel.Remove(&delayedTask.m_entry)) {
+      return false;
+    }
+  }
+
+  Mso::CntPtr<DelayedTask> wheelReference{&delayedTask, Mso::AttachTag};
+  delayedTask.CancelTask();
+  return true;
+}
+
+void DelayedTaskScheduler::TakeDueTasks(/*out*/ std::vector<Mso::CntPtr<DelayedTask>> &dueTasks) noexcept {
+  m_wheel.Advance(ToCurrentTick(std::chrono::steady_clock::now()), /*out*/ m_expired);
+  for (TimerWheelEntry *entry : m_expired) {
+    dueTasks.emplace_back(static_cast<DelayedTaskEntry *>(entry)->Task, Mso::AttachTag);
+  }
+
+  m_expired.clear();
+}
+
+#if defined(MS_TARGET_POSIX)
+
+void DelayedTaskScheduler::Run() noexcept {
+  std::vector<Mso::CntPtr<DelayedTask>> dueTasks;
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    TakeDueTasks(/*out*/ dueTasks);
+    if (!dueTasks.empty()) {
+      lock.unlock();
+      for (auto &dueTask : dueTasks) {
+        dueTask->Post();
+      }
+
+      dueTasks.clear();
+      lock.lock();
+      continue;
+    }
+
+    if (auto nextTick = m_wheel.NextTick()) {
+      m_wakeUpTick = *nextTick;
+      m_wakeUp.wait_until(lock, ToTime(*nextTick));
+    } else {
+      m_wakeUpTick = NoWakeUp;
+      m_wakeUp.wait(lock);
+    }
+
+    m_wakeUpTick = 0;
+  }
+}
+
+#else
+
+/*static*/ void __stdcall DelayedTaskScheduler::TimerCallback(
+    _Inout_ PTP_CALLBACK_INSTANCE /*instance*/,
+    _Inout_opt_ PVOID context,
+    _Inout_ PTP_TIMER /*timer*/) {
+  static_cast<DelayedTaskScheduler *>(context)->OnTimer();
+}
+
+void DelayedTaskScheduler::OnTimer() noexcept {
+  std::vector<Mso::CntPtr<DelayedTask>> dueTasks;
+  {
+    std::lock_guard lock{m_mutex};
+    TakeDueTasks(/*out*/ dueTasks);
+
+    // The timer may fire before the tick it was set to: it is set again for the tasks that are left.
+    if (auto nextTick = m_wheel.NextTick()) {
+      SetTimer(*nextTick);
+    } else {
+      m_wakeUpTick = NoWakeUp;
+    }
+  }
+
+  for (auto &dueTask : dueTasks) {
+    dueTask->Post();
+  }
+}
+
+void DelayedTaskScheduler::SetTimer(uint64_t tick) noexcept {
+  // A negative due time is relative to now, in 100ns units.
+  auto delay = std::max(ToTime(tick) - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero());
+  ULARGE_INTEGER dueTime;
+  dueTime.QuadPart = static_cast<ULONGLONG>(
+      -std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>>(delay).count());
+  FILETIME fileTime{dueTime.LowPart, dueTime.HighPart};
+  ::SetThreadpoolTimer(m_timer, &fileTime, /*msPeriod:*/ 0, /*msWindowLength:*/ 0);
+  m_wakeUpTick = tick;
+}
+
+#endif
+
+uint64_t DelayedTaskScheduler::ToDueTick(TimePoint dueTime) const noexcept {
+  // Round up, so that the task is never posted before its due time.
+  if (dueTime <= m_startTime) {
+    return 0;
+  }
+
+  return static_cast<uint64_t>((dueTime - m_startTime + 1ms - std::chrono::steady_clock::duration{1}) / 1ms);
+}
+
+uint64_t DelayedTaskScheduler::ToCurrentTick(TimePoint now) const noexcept {
+  return static_cast<uint64_t>((now - m_startTime) / 1ms);
+}
+
+DelayedTaskScheduler::TimePoint DelayedTaskScheduler::ToTime(uint64_t tick) const noexcept {
+  return m_startTime + std::chrono::milliseconds{tick};
+}
+
+} // namespace Mso
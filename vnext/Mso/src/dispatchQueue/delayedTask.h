@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "object/unknownObject.h"
+#include "timerWheel.h"
+
+#if defined(MS_TARGET_POSIX)
+#include <condition_variable>
+#include <thread>
+#endif
+
+namespace Mso {
+
+// Forward declarations
+struct DelayedTask;
+struct DelayedTaskScheduler;
+
+//! Entry of a DelayedTask in the TimerWheel.
+struct DelayedTaskEntry : TimerWheelEntry {
+  DelayedTask *Task{nullptr};
+};
+
+//! A task that is posted to its queue when it is due.
+//! It only holds a weak reference to the queue: the task is canceled if the queue is gone by then.
+struct DelayedTask : Mso::UnknownObject<IDispatchDelayedTask> {
+  DelayedTask(Mso::WeakPtr<IDispatchQueueService> &&queue, DispatchTask &&task) noexcept;
+
+  //! Post the task to its queue, or cancel it if the queue is destroyed.
+  void Post() noexcept;
+
+  //! Cancel the task through its queue, or directly if the queue is destroyed.
+  void CancelTask() noexcept;
+
+ public: // IDispatchDelayedTask
+  bool Cancel() noexcept override;
+
+ private:
+  friend DelayedTaskScheduler;
+  DelayedTaskEntry m_entry;
+  const Mso::WeakPtr<IDispatchQueueService> m_queue;
+  DispatchTask m_task;
+};
+
+//! Posts the delayed tasks of all dispatch queues to their queues when they are due.
+//! The tasks are kept in one TimerWheel with 1ms ticks. The scheduler wakes up at the next tick where the wheel
+//! has work, so the queues and their schedulers are not involved until a task is due.
+//! On Windows the wake up is a thread pool timer, so the scheduler owns no thread that could outlive the module.
+//! On POSIX platforms one thread sleeps until the next tick.
+//! The wheel holds a reference to each of its tasks. A task is owned by whoever removes it from the wheel:
+//! the wake up that posts it or the Cancel call.
+struct DelayedTaskScheduler {
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  static DelayedTaskScheduler &Instance() noexcept;
+
+  DispatchDelayedTask
+  Schedule(Mso::WeakPtr<IDispatchQueueService> &&queue, DispatchTask &&task, TimePoint dueTime) noexcept;
+  bool Cancel(DelayedTask &delayedTask) noexcept;
+
+ private:
+  DelayedTaskScheduler() noexcept;
+
+  //! Advance the wheel to the current tick and take the tasks that are due. The lock must be held.
+  void TakeDueTasks(/*out*/ std::vector<Mso::CntPtr<DelayedTask>> &dueTasks) noexcept;
+
+#if defined(MS_TARGET_POSIX)
+  void Run() noexcept;
+#else
+  static void __stdcall TimerCallback(
+      _Inout_ PTP_CALLBACK_INSTANCE instance,
+      _Inout_opt_ PVOID context,
+      _Inout_ PTP_TIMER timer);
+  void OnTimer() noexcept;
+  void SetTimer(uint64_t tick) noexcept;
+#endif
+
+  uint64_t ToDueTick(TimePoint dueTime) const noexcept;
+  uint64_t ToCurrentTick(TimePoint now) const noexcept;
+  TimePoint ToTime(uint64_t tick) const noexcept;
+
+  constexpr static uint64_t NoWakeUp{UINT64_MAX};
+
+ private:
+  const TimePoint m_startTime{std::chrono::steady_clock::now()};
+  std::mutex m_mutex;
+  TimerWheel m_wheel;
+  std::vector<TimerWheelEntry *> m_expired;
+
+#if defined(MS_TARGET_POSIX)
+  std::condition_variable m_wakeUp;
+  uint64_t m_wakeUpTick{0}; // The tick the thread sleeps until. Zero while the thread is awake.
+  std::thread m_thread; // it must be last in the initialization list
+#else
+  uint64_t m_wakeUpTick{NoWakeUp}; // The tick the timer is set to.
+  PTP_TIMER m_timer{nullptr};
+#endif
+};
+
+} // namespace Mso
@@ -13,6 +13,9 @@ struct LooperScheduler : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDis
 
   static void RunLoop(const Mso::WeakPtr<LooperScheduler> &weakSelf) noexcept;
 
+  //! Wake up the looper thread if it waits for new tasks.
+  void WakeUp() noexcept;
+
  public: // IDispatchQueueScheduler
   void IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
   bool HasThreadAccess() noexcept override;
@@ -21,8 +24,19 @@ struct LooperScheduler : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDis
   void Shutdown() noexcept override;
   void AwaitTermination() noexcept override;
 
+ private:
+  //! The looper thread sets Running before it checks the queue, and it waits only after it changes Running to Idle.
+  //! Post changes the state to Notified and sets the m_wakeUpEvent only if it was Idle.
+  //! So, the event is not used while the looper thread runs tasks.
+  enum class LooperState : uint32_t {
+    Running,
+    Idle,
+    Notified,
+  };
+
  private:
   ManualResetEvent m_wakeUpEvent;
+  std::atomic<LooperState> m_state{LooperState::Running};
   Mso::WeakPtr<IDispatchQueueService> m_queue;
   std::atomic_bool m_isShutdown{false};
   std::thread m_looperThread; // it must be last in the initialization list
@@ -42,6 +56,7 @@ LooperScheduler::~LooperScheduler() noexcept {
 /*static*/ void LooperScheduler::RunLoop(const Mso::WeakPtr<LooperScheduler> &weakSelf) noexcept {
   for (;;) {
     if (auto self = weakSelf.GetStrongPtr()) {
+      self->m_state.store(LooperState::Running);
       if (auto queue = self->m_queue.GetStrongPtr()) {
         DispatchTask task;
         while (queue->TryDequeTask(task)) {
@@ -53,8 +68,13 @@ LooperScheduler::~LooperScheduler() noexcept {
         break;
       }
 
-      self->m_wakeUpEvent.Wait();
-      self->m_wakeUpEvent.Reset();
+      // If a task was posted after we checked the queue, then the state is Notified and we check the queue again.
+      LooperState expectedState = LooperState::Running;
+      if (self->m_state.compare_exchange_strong(expectedState, LooperState::Idle)) {
+        self->m_wakeUpEvent.Wait();
+        self->m_wakeUpEvent.Reset();
+      }
+
       continue;
     }
 
@@ -75,12 +95,18 @@ bool LooperScheduler::IsSerial() noexcept {
 }
 
 void LooperScheduler::Post() noexcept {
-  m_wakeUpEvent.Set();
+  WakeUp();
 }
 
 void LooperScheduler::Shutdown() noexcept {
   m_isShutdown = true;
-  m_wakeUpEvent.Set();
+  WakeUp();
+}
+
+void LooperScheduler::WakeUp() noexcept {
+  if (m_state.exchange(LooperState::Notified) == LooperState::Idle) {
+    m_wakeUpEvent.Set();
+  }
 }
 
 void LooperScheduler::AwaitTermination() noexcept {
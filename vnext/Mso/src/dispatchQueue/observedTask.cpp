@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "observedTask.h"
+
+namespace Mso {
+
+//=============================================================================
+// ObservedTask implementation.
+//=============================================================================
+
+ObservedTask::ObservedTask(DispatchTask &&task, Mso::CntPtr<IDispatchTaskObserver> &&observer) noexcept
+    : m_task{std::move(task)}, m_observer{std::move(observer)} {
+  m_observer->OnTaskPosted();
+}
+
+void ObservedTask::Invoke() noexcept {
+  auto startTime = std::chrono::steady_clock::now();
+  m_task.Get()->Invoke();
+  m_task = nullptr;
+  m_observer->OnTaskInvoked(startTime - m_postTime, std::chrono::steady_clock::now() - startTime);
+}
+
+void ObservedTask::OnCancel() noexcept {
+  if (auto cancellation = query_cast<ICancellationListener *>(m_task.Get())) {
+    cancellation->OnCancel();
+  }
+
+  m_task = nullptr;
+  m_observer->OnTaskCanceled();
+}
+
+} // namespace Mso
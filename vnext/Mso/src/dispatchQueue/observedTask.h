@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <chrono>
+#include "dispatchQueue/dispatchQueue.h"
+#include "object/unknownObject.h"
+
+namespace Mso {
+
+//! Wraps a posted task to tell the IDispatchTaskObserver how long the task waited in the queue and how long it ran.
+struct ObservedTask : UnknownObject<QueryCastHidden<IVoidFunctor>, ICancellationListener> {
+  ObservedTask(DispatchTask &&task, Mso::CntPtr<IDispatchTaskObserver> &&observer) noexcept;
+
+ public: // IVoidFunctor
+  void Invoke() noexcept override;
+
+ public: // ICancellationListener
+  void OnCancel() noexcept override;
+
+ private:
+  DispatchTask m_task;
+  const Mso::CntPtr<IDispatchTaskObserver> m_observer;
+  const std::chrono::steady_clock::time_point m_postTime{std::chrono::steady_clock::now()};
+};
+
+} // namespace Mso
@@ -2,6 +2,8 @@
 // Licensed under the MIT license.
 
 #include "queueService.h"
+#include "delayedTask.h"
+#include "observedTask.h"
 #include "taskBatch.h"
 #include "taskContext.h"
 
@@ -23,6 +25,30 @@ QueueService::~QueueService() noexcept {
 void QueueService::Post(DispatchTask &&task) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
+  if (auto observer = m_taskObserver.load(std::memory_order_acquire)) {
+    task = DispatchTask{
+        Mso::Make<ObservedTask, IVoidFunctor>(std::move(task), Mso::CntPtr<IDispatchTaskObserver>{observer})};
+  }
+
+  // Unless this thread batches tasks, post without taking the lock. Shutdown waits for the
+  // posts in flight, and Resume counts any task that was enqueued while suspended.
+  if (m_taskBatchCount.load() == 0) {
+    ++m_activePostCount;
+    if (m_isShutdown.load()) {
+      --m_activePostCount;
+      CancelTask(std::move(task));
+      return;
+    }
+
+    m_queue.Enqueue(std::move(task));
+    --m_activePostCount;
+    if (m_suspendCounter.load() == 0) {
+      m_scheduler->Post();
+    }
+
+    return;
+  }
+
   bool isShutdown = false;
   bool shouldSchedule = false;
 
@@ -89,11 +115,21 @@ void QueueService::DeferElsePost(DispatchTask &&task) noexcept {
   }
 }
 
+DispatchDelayedTask QueueService::PostAt(DispatchTask &&task, std::chrono::steady_clock::time_point dueTime) noexcept {
+  VerifyElseCrashSz(task, "The task is empty");
+  return DelayedTaskScheduler::Instance().Schedule(
+      Mso::WeakPtr<IDispatchQueueService>{this}, std::move(task), dueTime);
+}
+
 void QueueService::BeginTaskBatching() noexcept {
   auto taskBatch{Mso::Make<TaskBatch>()};
   std::lock_guard lock{m_mutex};
   auto result = m_taskBatches.try_emplace(std::this_thread::get_id(), std::move(taskBatch));
   if (result.second) {
+    ++m_taskBatchCount;
+  } else {
+    // The thread already batches tasks: the new batch encloses the current one.
+    // The try_emplace does not move the taskBatch when the key exists.
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
@@ -109,6 +145,7 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
       it->second = std::move(enclosingBatch);
     } else {
       m_taskBatches.erase(it);
+      --m_taskBatchCount;
     }
   } else {
     taskBatch = Mso::Make<TaskBatch>();
@@ -170,6 +207,13 @@ void QueueService::Resume() noexcept {
 void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   std::vector<DispatchTask> tasksToCancel;
 
+  // Posts that started before the shutdown finish enqueueing first, so that no task is
+  // enqueued after the pending tasks are cancelled.
+  m_isShutdown = true;
+  while (m_activePostCount.load() != 0) {
+    std::this_thread::yield();
+  }
+
   {
     std::lock_guard lock{m_mutex};
     m_shutdownAction = pendingTaskAction;
@@ -219,6 +263,18 @@ void QueueService::CancelTask(DispatchTask &&task) noexcept {
   }
 }
 
+bool QueueService::SetTaskObserver(Mso::CntPtr<IDispatchTaskObserver> &&observer) noexcept {
+  VerifyElseCrashSz(observer, "The observer is null");
+  std::lock_guard lock{m_mutex};
+  if (m_taskObserverHolder) {
+    return m_taskObserverHolder == observer;
+  }
+
+  m_taskObserverHolder = std::move(observer);
+  m_taskObserver.store(m_taskObserverHolder.Get(), std::memory_order_release);
+  return true;
+}
+
 //=============================================================================
 // LocalValueEntry implementation.
 //=============================================================================
@@ -294,4 +350,8 @@ DispatchQueue DispatchQueueStatic::MakeCustomQueue(Mso::CntPtr<IDispatchQueueSch
   return Mso::Make<QueueService, IDispatchQueueService>(std::move(scheduler));
 }
 
+DispatchQueue DispatchQueueStatic::MakeWorkStealingQueue(uint32_t maxThreads) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(MakeWorkStealingScheduler(maxThreads));
+}
+
 } // namespace Mso
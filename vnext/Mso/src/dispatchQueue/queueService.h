@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <thread>
+#include <vector>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "object/refCountedObject.h"
 #include "taskQueue.h"
@@ -37,6 +39,7 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   bool HasThreadAccess() noexcept override;
   void InvokeElsePost(DispatchTask &&task) noexcept override;
   void DeferElsePost(DispatchTask &&task) noexcept override;
+  DispatchDelayedTask PostAt(DispatchTask &&task, std::chrono::steady_clock::time_point dueTime) noexcept override;
   void BeginTaskBatching() noexcept override;
   DispatchTask EndTaskBatching() noexcept override;
   bool HasTaskBatching() noexcept override;
@@ -50,6 +53,7 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   bool TryDequeTask(/*out*/ DispatchTask &task) noexcept override;
   void InvokeTask(DispatchTask &&task, std::optional<std::chrono::steady_clock::time_point> endTime) noexcept override;
   void CancelTask(DispatchTask &&task) noexcept override;
+  bool SetTaskObserver(Mso::CntPtr<IDispatchTaskObserver> &&observer) noexcept override;
 
  private:
   bool TrySwapLocalValue(
@@ -62,8 +66,17 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   ThreadMutex m_mutex;
   TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
   std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  std::atomic<int32_t> m_suspendCounter{0};
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
+
+  // Read by Post without the lock.
+  std::atomic<bool> m_isShutdown{false};
+  std::atomic<size_t> m_taskBatchCount{0}; // Threads with task batching.
+  std::atomic<uint32_t> m_activePostCount{0};
+
+  // Post reads the observer without the lock. It is set once and kept alive until the queue is destroyed.
+  std::atomic<IDispatchTaskObserver *> m_taskObserver{nullptr};
+  Mso::CntPtr<IDispatchTaskObserver> m_taskObserverHolder;
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
 };
 
@@ -85,6 +98,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   static Mso::CntPtr<IDispatchQueueScheduler> MakeMainUIScheduler() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeCurrentThreadUIScheduler() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeThreadPoolScheduler(uint32_t maxThreads) noexcept;
+  static Mso::CntPtr<IDispatchQueueScheduler> MakeWorkStealingScheduler(uint32_t maxThreads) noexcept;
 
  public: // IDispatchQueueStatic
   DispatchQueue CurrentQueue() noexcept override;
@@ -95,6 +109,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   DispatchQueue MakeCurrentThreadUIQueue() noexcept override;
   DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept override;
   DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept override;
+  DispatchQueue MakeWorkStealingQueue(uint32_t maxThreads) noexcept override;
 };
 
 } // namespace Mso
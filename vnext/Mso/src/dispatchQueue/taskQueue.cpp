@@ -38,63 +38,135 @@ bool TaskReadBuffer::IsEmpty() const noexcept {
 // TaskQueue implementation.
 //=============================================================================
 
-TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept : m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
+TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept
+    : m_ring{std::make_unique<RingSlot[]>(RingCapacity)}, m_weakOwnerPtr{std::move(weakOwnerPtr)} {
+  for (size_t i = 0; i < RingCapacity; ++i) {
+    m_ring[i].Sequence.store(i, std::memory_order_relaxed);
+  }
+}
 
 TaskQueue::~TaskQueue() noexcept {
   VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
 }
 
 void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
-  bool queueWasEmpty{IsEmpty()};
-  m_writeBuffer.push_back(std::move(task));
-  if (queueWasEmpty) {
-    m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+  // Once the ring buffer overflows, new items follow the ones in the overflow queue
+  // until the consumer empties it.
+  if (m_isOverflowing.load(std::memory_order_acquire) || !TryEnqueueRing(task)) {
+    std::lock_guard lock{m_overflowMutex};
+    m_isOverflowing.store(true, std::memory_order_relaxed);
+    m_writeBuffer.push_back(std::move(task));
   }
+
+  UpdateSize(1);
 }
 
-bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
+bool TaskQueue::TryEnqueueRing(DispatchTask &task) noexcept {
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  for (;;) {
+    RingSlot &slot = m_ring[pos & (RingCapacity - 1)];
+    ptrdiff_t diff = static_cast<ptrdiff_t>(slot.Sequence.load(std::memory_order_acquire) - pos);
+    if (diff == 0) {
+      // The slot is free: claim it.
+      if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        slot.Task = std::move(task);
+        slot.Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      return false; // The ring buffer is full.
+    } else {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool TaskQueue::TryDequeueRing(/*out*/ DispatchTask &task) noexcept {
+  RingSlot &slot = m_ring[m_dequeuePos & (RingCapacity - 1)];
+  if (slot.Sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+    return false;
+  }
+
+  task = std::move(slot.Task);
+  slot.Sequence.store(m_dequeuePos + RingCapacity, std::memory_order_release);
+  ++m_dequeuePos;
+  return true;
+}
+
+bool TaskQueue::TryDequeueOverflow(/*out*/ DispatchTask &task) noexcept {
+  if (!m_isOverflowing.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  std::lock_guard lock{m_overflowMutex};
   if (m_readBuffer.IsEmpty() && !m_writeBuffer.empty()) {
     m_readBuffer.SwapBuffer(m_writeBuffer);
   }
 
   bool result = m_readBuffer.TryDequeue(/*out*/ task);
-  if (result && IsEmpty()) {
-    m_strongOwnerPtr = nullptr;
+  if (m_readBuffer.IsEmpty() && m_writeBuffer.empty()) {
+    m_isOverflowing.store(false, std::memory_order_release);
   }
 
   return result;
 }
 
-bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
-  if (IsEmpty()) {
-    return false;
+bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
+  bool result = TryDequeueRing(/*out*/ task) || TryDequeueOverflow(/*out*/ task);
+  if (result) {
+    UpdateSize(-1);
   }
 
-  tasks.reserve(tasks.size() + m_readBuffer.Size() + m_writeBuffer.size());
+  return result;
+}
 
-  if (!m_readBuffer.IsEmpty()) {
-    std::vector<DispatchTask> readBuffer;
-    m_readBuffer.SwapBuffer(readBuffer);
-    tasks.insert(tasks.end(), std::make_move_iterator(readBuffer.begin()), std::make_move_iterator(readBuffer.end()));
+bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  size_t count{0};
+  DispatchTask task;
+  while (TryDequeueRing(/*out*/ task) || TryDequeueOverflow(/*out*/ task)) {
+    tasks.push_back(std::move(task));
+    ++count;
   }
 
-  if (!m_writeBuffer.empty()) {
-    tasks.insert(
-        tasks.end(), std::make_move_iterator(m_writeBuffer.begin()), std::make_move_iterator(m_writeBuffer.end()));
-    m_writeBuffer.clear();
+  if (count == 0) {
+    return false;
   }
 
-  m_strongOwnerPtr = nullptr;
-
+  UpdateSize(-static_cast<ptrdiff_t>(count));
   return true;
 }
 
+void TaskQueue::UpdateSize(ptrdiff_t delta) noexcept {
+  // The owner is kept alive while the queue has items. Whoever moves the size across zero
+  // brings the strong reference in line with the current size. The last of them sees the
+  // final size.
+  ptrdiff_t prevSize = m_size.fetch_add(delta);
+  if ((prevSize > 0) == (prevSize + delta > 0)) {
+    return;
+  }
+
+  Mso::CntPtr<IUnknown> ownerToRelease;
+  {
+    std::lock_guard lock{m_ownerMutex};
+    if (m_size.load() > 0) {
+      if (!m_strongOwnerPtr) {
+        m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+      }
+    } else {
+      ownerToRelease = std::move(m_strongOwnerPtr);
+    }
+  }
+}
+
 size_t TaskQueue::Size() const noexcept {
-  return m_readBuffer.Size() + m_writeBuffer.size();
+  ptrdiff_t size = m_size.load();
+  return size > 0 ? static_cast<size_t>(size) : 0;
 }
 
 bool TaskQueue::IsEmpty() const noexcept {
-  return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
+  RingSlot &slot = m_ring[m_dequeuePos & (RingCapacity - 1)];
+  return slot.Sequence.load(std::memory_order_acquire) != m_dequeuePos + 1 &&
+      !m_isOverflowing.load(std::memory_order_acquire);
 }
 
 } // namespace Mso
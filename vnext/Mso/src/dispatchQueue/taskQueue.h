@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
 #include "threadMutex.h"
@@ -28,11 +31,16 @@ struct TaskReadBuffer {
   size_t m_index{0};
 };
 
-//! Simple queue that uses two buffers: one for pushing items and another for popping them.
-//! Items are always enqueued under lock.
+//! Multi-producer queue. Items are enqueued without a lock into a bounded ring buffer.
+//! Each slot has a sequence number that tells whether it is free or holds an item.
+//! When the ring buffer is full, items go to an overflow queue under lock until the
+//! consumer empties it, so that the items of each producer stay in order.
 //!
-//! Internally we have two vectors: one to enqueue items (write) and another to dequeue items (read).
-//! When the read queue is empty we swap them.
+//! The overflow queue uses two vectors: one to enqueue items (write) and another to dequeue
+//! items (read). When the read queue is empty we swap them.
+//!
+//! Enqueue may be called from any thread. TryDequeue, DequeueAll and IsEmpty must not be
+//! called concurrently with each other; the owner serializes them.
 struct TaskQueue {
   TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
 
@@ -49,8 +57,33 @@ struct TaskQueue {
   bool IsEmpty() const noexcept;
 
  private:
+  struct RingSlot {
+    std::atomic<size_t> Sequence{0};
+    DispatchTask Task;
+  };
+
+  bool TryEnqueueRing(DispatchTask &task) noexcept;
+  bool TryDequeueRing(DispatchTask &task) noexcept;
+  bool TryDequeueOverflow(DispatchTask &task) noexcept;
+  void UpdateSize(ptrdiff_t delta) noexcept;
+
+  constexpr static size_t RingCapacity{1024}; // Must be a power of two.
+
+ private:
+  const std::unique_ptr<RingSlot[]> m_ring;
+  std::atomic<size_t> m_enqueuePos{0};
+  size_t m_dequeuePos{0};
+
+  std::mutex m_overflowMutex;
+  std::atomic<bool> m_isOverflowing{false};
   std::vector<DispatchTask> m_writeBuffer; // To enqueue items.
   TaskReadBuffer m_readBuffer; // To dequeue items.
+
+  // Enqueued minus dequeued items. It may briefly go negative when an item is dequeued before
+  // its producer counts it.
+  std::atomic<ptrdiff_t> m_size{0};
+
+  std::mutex m_ownerMutex;
   Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
   Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queu is not empty;
 };
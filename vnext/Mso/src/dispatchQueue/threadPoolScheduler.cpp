@@ -0,0 +1,383 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+using namespace std::chrono_literals;
+
+namespace Mso {
+
+struct WorkStealingScheduler;
+
+//! A work item asks the scheduler to handle the tasks of its dispatch queue.
+//! It keeps the scheduler alive until the work item is completed.
+using ThreadPoolWork = Mso::CntPtr<WorkStealingScheduler>;
+
+//! Portable thread pool that is shared by all WorkStealingScheduler instances.
+//! Each worker thread has its own deque of work items. Work items submitted from a worker thread
+//! go to its deque, and work items submitted from other threads go to a shared injection deque.
+//! A worker takes the oldest item from its own deque, then from the injection deque, and when
+//! both are empty it steals the newest item from the other workers.
+//!
+//! A work item stands for a dispatch queue that has tasks, not for a single task: a scheduler
+//! submits at most maxThreads of them, and each one dequeues tasks from its QueueService under
+//! the queue's lock. So the per-worker deques only spread the dispatch queues over the workers;
+//! the threads that serve the same concurrent queue still take turns on its lock.
+//!
+//! There is one worker per hardware thread. Tasks that block would starve the other queues, so a
+//! monitor thread adds a worker when work is pending and no work item completed for
+//! StarvationTimeout. The added workers take work from the injection deque and steal from the
+//! others, and they exit after being idle for IdleWorkerTimeout.
+struct WorkStealingThreadPool {
+  static WorkStealingThreadPool &Instance() noexcept;
+
+  void Submit(ThreadPoolWork &&work) noexcept;
+
+ private:
+  WorkStealingThreadPool(size_t threadCount) noexcept;
+
+  void RunWorker(size_t workerIndex) noexcept;
+  void RunAddedWorker() noexcept;
+  void RunMonitor() noexcept;
+  bool TryTakeWork(size_t workerIndex, /*out*/ ThreadPoolWork &work) noexcept;
+
+  struct WorkDeque {
+    std::mutex Mutex;
+    std::deque<ThreadPoolWork> Items;
+  };
+
+ private:
+  const size_t m_workerCount;
+
+  // One deque per worker thread, and the injection deque at the end.
+  std::vector<std::unique_ptr<WorkDeque>> m_deques;
+  std::vector<std::thread> m_threads;
+
+  std::atomic<size_t> m_pendingWorkCount{0};
+  std::atomic<size_t> m_completedWorkCount{0};
+  std::atomic<size_t> m_sleepingWorkerCount{0};
+  std::atomic<bool> m_isMonitorWaiting{false};
+  size_t m_addedWorkerCount{0}; // Guarded by m_sleepMutex.
+  std::mutex m_sleepMutex;
+  std::condition_variable m_wakeUp;
+  std::condition_variable m_monitorWakeUp;
+
+  constexpr static auto StarvationTimeout{200ms};
+  constexpr static auto IdleWorkerTimeout{10s};
+  constexpr static size_t MaxAddedWorkerCount{64};
+
+  static thread_local WorkStealingThreadPool *tls_pool;
+  static thread_local size_t tls_workerIndex;
+};
+
+struct WorkStealingScheduler : Mso::UnknownObject<IDispatchQueueScheduler> {
+  WorkStealingScheduler(uint32_t maxThreads) noexcept;
+
+  //! Handles the dispatch queue tasks on a thread pool thread.
+  void RunWork() noexcept;
+
+ public: // IDispatchQueueScheduler
+  void IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  struct ThreadAccessGuard {
+    ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept;
+    ~ThreadAccessGuard() noexcept;
+
+    static bool HasThreadAccess(WorkStealingScheduler *scheduler) noexcept;
+
+   private:
+    WorkStealingScheduler *m_prevScheduler{nullptr};
+    static thread_local WorkStealingScheduler *tls_scheduler;
+  };
+
+ private:
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  const uint32_t m_maxThreads{1};
+  std::atomic<uint32_t> m_usedThreads{0};
+  std::mutex m_mutex;
+  std::condition_variable m_workCompleted;
+
+  constexpr static uint32_t MaxConcurrentThreads{64};
+};
+
+//=============================================================================
+// WorkStealingThreadPool implementation
+//=============================================================================
+
+/*static*/ thread_local WorkStealingThreadPool *WorkStealingThreadPool::tls_pool{nullptr};
+/*static*/ thread_local size_t WorkStealingThreadPool::tls_workerIndex{0};
+
+/*static*/ WorkStealingThreadPool &WorkStealingThreadPool::Instance() noexcept {
+  // The thread pool is never destroyed because global dispatch queues may use it during the process shutdown.
+  static WorkStealingThreadPool *instance{
+      new WorkStealingThreadPool(std::max(2u, std::thread::hardware_concurrency()))};
+  return *instance;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t threadCount) noexcept : m_workerCount{threadCount} {
+  for (size_t i = 0; i <= m_workerCount; ++i) {
+    m_deques.push_back(std::make_unique<WorkDeque>());
+  }
+
+  for (size_t i = 0; i < m_workerCount; ++i) {
+    m_threads.emplace_back([this, i]() noexcept { RunWorker(i); });
+  }
+
+  m_threads.emplace_back([this]() noexcept { RunMonitor(); });
+}
+
+void WorkStealingThreadPool::Submit(ThreadPoolWork &&work) noexcept {
+  size_t dequeIndex = (tls_pool == this) ? tls_workerIndex : m_workerCount;
+  {
+    WorkDeque &deque = *m_deques[dequeIndex];
+    std::lock_guard lock{deque.Mutex};
+    deque.Items.push_back(std::move(work));
+  }
+
+  // A worker increments m_sleepingWorkerCount before it checks m_pendingWorkCount under the m_sleepMutex.
+  // Either it sees the new work item, or we see it sleeping and wake it up. The same goes for the monitor.
+  ++m_pendingWorkCount;
+  const bool isWorkerSleeping = m_sleepingWorkerCount.load() != 0;
+  const bool isMonitorWaiting = m_isMonitorWaiting.load();
+  if (isWorkerSleeping || isMonitorWaiting) {
+    {
+      std::lock_guard lock{m_sleepMutex};
+    }
+
+    if (isWorkerSleeping) {
+      m_wakeUp.notify_one();
+    }
+
+    if (isMonitorWaiting) {
+      m_monitorWakeUp.notify_one();
+    }
+  }
+}
+
+void WorkStealingThreadPool::RunWorker(size_t workerIndex) noexcept {
+  tls_pool = this;
+  tls_workerIndex = workerIndex;
+
+  for (;;) {
+    ThreadPoolWork work;
+    if (TryTakeWork(workerIndex, /*out*/ work)) {
+      work->RunWork();
+      ++m_completedWorkCount;
+      continue;
+    }
+
+    std::unique_lock lock{m_sleepMutex};
+    ++m_sleepingWorkerCount;
+    m_wakeUp.wait(lock, [this]() noexcept { return m_pendingWorkCount.load() != 0; });
+    --m_sleepingWorkerCount;
+  }
+}
+
+void WorkStealingThreadPool::RunAddedWorker() noexcept {
+  // Added workers have no deque of their own: the work items they submit go to the injection deque.
+  tls_pool = this;
+  tls_workerIndex = m_workerCount;
+
+  for (;;) {
+    ThreadPoolWork work;
+    if (TryTakeWork(m_workerCount, /*out*/ work)) {
+      work->RunWork();
+      ++m_completedWorkCount;
+      continue;
+    }
+
+    std::unique_lock lock{m_sleepMutex};
+    ++m_sleepingWorkerCount;
+    const bool hasWork =
+        m_wakeUp.wait_for(lock, IdleWorkerTimeout, [this]() noexcept { return m_pendingWorkCount.load() != 0; });
+    --m_sleepingWorkerCount;
+    if (!hasWork) {
+      --m_addedWorkerCount;
+      return;
+    }
+  }
+}
+
+void WorkStealingThreadPool::RunMonitor() noexcept {
+  size_t completedWorkCount{0};
+  std::unique_lock lock{m_sleepMutex};
+  for (;;) {
+    if (m_pendingWorkCount.load() == 0) {
+      m_isMonitorWaiting = true;
+      m_monitorWakeUp.wait(lock, [this]() noexcept { return m_pendingWorkCount.load() != 0; });
+      m_isMonitorWaiting = false;
+      completedWorkCount = m_completedWorkCount.load();
+    }
+
+    m_monitorWakeUp.wait_for(lock, StarvationTimeout);
+
+    // Work items finish within their time slice unless their tasks block. If none finished while work
+    // was waiting, then all workers are blocked and one more worker lets the waiting work run.
+    const size_t newCompletedWorkCount = m_completedWorkCount.load();
+    if (newCompletedWorkCount == completedWorkCount && m_pendingWorkCount.load() != 0 &&
+        m_sleepingWorkerCount.load() == 0 && m_addedWorkerCount < MaxAddedWorkerCount) {
+      ++m_addedWorkerCount;
+      std::thread([this]() noexcept { RunAddedWorker(); }).detach();
+    }
+
+    completedWorkCount = newCompletedWorkCount;
+  }
+}
+
+bool WorkStealingThreadPool::TryTakeWork(size_t workerIndex, /*out*/ ThreadPoolWork &work) noexcept {
+  auto tryPop = [&work](WorkDeque &deque, bool isOwner) noexcept {
+    std::lock_guard lock{deque.Mutex};
+    if (deque.Items.empty()) {
+      return false;
+    }
+
+    // The owner takes the oldest item so that a queue that reposts itself cannot starve the others.
+    // Thieves take from the other end.
+    if (isOwner) {
+      work = std::move(deque.Items.front());
+      deque.Items.pop_front();
+    } else {
+      work = std::move(deque.Items.back());
+      deque.Items.pop_back();
+    }
+
+    return true;
+  };
+
+  // The workerIndex of an added worker is m_workerCount: its own deque is the injection deque.
+  bool isTaken = tryPop(*m_deques[workerIndex], /*isOwner:*/ true) ||
+      (workerIndex != m_workerCount && tryPop(*m_deques[m_workerCount], /*isOwner:*/ true));
+  for (size_t i = 1; !isTaken && i <= m_workerCount; ++i) {
+    const size_t victimIndex = (workerIndex + i) % m_workerCount;
+    if (victimIndex != workerIndex) {
+      isTaken = tryPop(*m_deques[victimIndex], /*isOwner:*/ false);
+    }
+  }
+
+  if (isTaken) {
+    --m_pendingWorkCount;
+  }
+
+  return isTaken;
+}
+
+//=============================================================================
+// WorkStealingScheduler implementation
+//=============================================================================
+
+WorkStealingScheduler::WorkStealingScheduler(uint32_t maxThreads) noexcept
+    : m_maxThreads{maxThreads == 0 ? MaxConcurrentThreads : maxThreads} {}
+
+void WorkStealingScheduler::RunWork() noexcept {
+  auto queue = m_queue.GetStrongPtr();
+  if (queue) {
+    auto endTime = std::chrono::steady_clock::now() + 100ms;
+    DispatchTask task;
+    while (queue->TryDequeTask(task)) {
+      ThreadAccessGuard guard{this};
+      queue->InvokeTask(std::move(task), endTime);
+
+      if (std::chrono::steady_clock::now() > endTime) {
+        break;
+      }
+    }
+  }
+
+  --m_usedThreads; // We finished using this thread.
+  {
+    // Lock the mutex to avoid a lost wake up in AwaitTermination.
+    std::lock_guard lock{m_mutex};
+  }
+  m_workCompleted.notify_all();
+
+  if (queue && queue->HasTasks()) {
+    Post();
+  }
+}
+
+void WorkStealingScheduler::IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool WorkStealingScheduler::HasThreadAccess() noexcept {
+  return ThreadAccessGuard::HasThreadAccess(this);
+}
+
+bool WorkStealingScheduler::IsSerial() noexcept {
+  return m_maxThreads == 1;
+}
+
+void WorkStealingScheduler::Post() noexcept {
+  //! Submit a work item if number of used threads is below m_maxThreads
+  uint32_t usedThreads = m_usedThreads.load(std::memory_order_relaxed);
+  do {
+    if (usedThreads == m_maxThreads) {
+      return;
+    }
+  } while (!m_usedThreads.compare_exchange_weak(
+      usedThreads, usedThreads + 1, std::memory_order_release, std::memory_order_relaxed));
+
+  WorkStealingThreadPool::Instance().Submit(ThreadPoolWork{this});
+}
+
+void WorkStealingScheduler::Shutdown() noexcept {
+  // It is not used by this scheduler
+}
+
+void WorkStealingScheduler::AwaitTermination() noexcept {
+  // The work items keep the scheduler alive. If we are called from one of them, then we do not wait for it.
+  const uint32_t ownWorkCount = HasThreadAccess() ? 1 : 0;
+  std::unique_lock lock{m_mutex};
+  m_workCompleted.wait(lock, [this, ownWorkCount]() noexcept { return m_usedThreads.load() <= ownWorkCount; });
+}
+
+//=============================================================================
+// WorkStealingScheduler::ThreadAccessGuard implementation
+//=============================================================================
+
+/*static*/ thread_local WorkStealingScheduler *WorkStealingScheduler::ThreadAccessGuard::tls_scheduler{nullptr};
+
+WorkStealingScheduler::ThreadAccessGuard::ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept
+    : m_prevScheduler{tls_scheduler} {
+  tls_scheduler = scheduler;
+}
+
+WorkStealingScheduler::ThreadAccessGuard::~ThreadAccessGuard() noexcept {
+  tls_scheduler = m_prevScheduler;
+}
+
+/*static*/ bool WorkStealingScheduler::ThreadAccessGuard::HasThreadAccess(WorkStealingScheduler *scheduler) noexcept {
+  return tls_scheduler == scheduler;
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeWorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeWorkStealingScheduler(
+    uint32_t maxThreads) noexcept {
+  return Mso::Make<WorkStealingScheduler, IDispatchQueueScheduler>(maxThreads);
+}
+
+#if defined(MS_TARGET_POSIX)
+// There is no Windows thread pool on POSIX platforms.
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeThreadPoolScheduler(
+    uint32_t maxThreads) noexcept {
+  return MakeWorkStealingScheduler(maxThreads);
+}
+#endif
+
+} // namespace Mso
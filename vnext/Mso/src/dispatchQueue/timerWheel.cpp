@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "timerWheel.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Mso {
+
+namespace {
+
+//! Index of the lowest set bit. The value must not be zero.
+inline uint32_t LowestBitIndex(uint64_t value) noexcept {
+#if defined(_MSC_VER)
+  unsigned long index{0};
+  _BitScanForward64(&index, value);
+  return static_cast<uint32_t>(index);
+#else
+  return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+} // namespace
+
+//=============================================================================
+// TimerWheel implementation
+//=============================================================================
+
+bool TimerWheel::Insert(TimerWheelEntry *entry) noexcept {
+  if (entry->DueTick <= m_currentTick) {
+    return false;
+  }
+
+  std::vector<TimerWheelEntry *> expired;
+  Place(entry, expired);
+  return true;
+}
+
+bool TimerWheel::Remove(TimerWheelEntry *entry) noexcept {
+  if (!entry->m_isLinked) {
+    return false;
+  }
+
+  Unlink(entry);
+  return true;
+}
+
+void TimerWheel::Advance(uint64_t nowTick, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept {
+  while (m_currentTick < nowTick) {
+    // Skip the ticks where nothing happens.
+    auto nextTick = NextTick();
+    if (!nextTick || *nextTick > nowTick) {
+      m_currentTick = nowTick;
+      break;
+    }
+
+    m_currentTick = *nextTick;
+
+    // Higher levels move their entries down first because they may land in the lower level slots.
+    for (uint32_t level = LevelCount - 1; level > 0; --level) {
+      if ((m_currentTick & ((uint64_t{1} << (SlotBits * level)) - 1)) == 0) {
+        MoveDown(static_cast<uint8_t>(level), expired);
+      }
+    }
+
+    uint8_t slot = static_cast<uint8_t>(m_currentTick & (SlotCount - 1));
+    while (TimerWheelEntry *entry = m_slots[0][slot]) {
+      Unlink(entry);
+      expired.push_back(entry);
+    }
+  }
+}
+
+std::optional<uint64_t> TimerWheel::NextTick() const noexcept {
+  if (m_size == 0) {
+    return std::nullopt;
+  }
+
+  for (uint32_t level = 0; level < LevelCount; ++level) {
+    const uint32_t shift = SlotBits * level;
+    const uint64_t slot = (m_currentTick >> shift) & (SlotCount - 1);
+    const uint64_t blockStart = (m_currentTick >> (shift + SlotBits)) << (shift + SlotBits);
+
+    // Entries of the lower levels are always in the slots after the current one.
+    uint64_t nextSlots = (slot == SlotCount - 1) ? 0 : (m_occupiedSlots[level] & (~uint64_t{0} << (slot + 1)));
+    if (nextSlots != 0) {
+      return blockStart + (uint64_t{LowestBitIndex(nextSlots)} << shift);
+    }
+
+    // The top level wraps around.
+    if (level == LevelCount - 1 && m_occupiedSlots[level] != 0) {
+      return blockStart + (uint64_t{1} << (shift + SlotBits)) +
+          (uint64_t{LowestBitIndex(m_occupiedSlots[level])} << shift);
+    }
+  }
+
+  return std::nullopt;
+}
+
+uint64_t TimerWheel::CurrentTick() const noexcept {
+  return m_currentTick;
+}
+
+size_t TimerWheel::Size() const noexcept {
+  return m_size;
+}
+
+void TimerWheel::Link(TimerWheelEntry *entry, uint8_t level, uint8_t slot) noexcept {
+  TimerWheelEntry *&head = m_slots[level][slot];
+  entry->m_prev = nullptr;
+  entry->m_next = head;
+  if (head) {
+    head->m_prev = entry;
+  }
+
+  head = entry;
+  entry->m_level = level;
+  entry->m_slot = slot;
+  entry->m_isLinked = true;
+  m_occupiedSlots[level] |= uint64_t{1} << slot;
+  ++m_size;
+}
+
+void TimerWheel::Unlink(TimerWheelEntry *entry) noexcept {
+  if (entry->m_prev) {
+    entry->m_prev->m_next = entry->m_next;
+  } else {
+    m_slots[entry->m_level][entry->m_slot] = entry->m_next;
+    if (!entry->m_next) {
+      m_occupiedSlots[entry->m_level] &= ~(uint64_t{1} << entry->m_slot);
+    }
+  }
+
+  if (entry->m_next) {
+    entry->m_next->m_prev = entry->m_prev;
+  }
+
+  entry->m_prev = nullptr;
+  entry->m_next = nullptr;
+  entry->m_isLinked = false;
+  --m_size;
+}
+
+void TimerWheel::Place(TimerWheelEntry *entry, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept {
+  if (entry->DueTick <= m_currentTick) {
+    expired.push_back(entry);
+    return;
+  }
+
+  uint32_t level = 0;
+  while (level < LevelCount - 1 &&
+         (entry->DueTick >> (SlotBits * (level + 1))) != (m_currentTick >> (SlotBits * (level + 1)))) {
+    ++level;
+  }
+
+  uint8_t slot = static_cast<uint8_t>((entry->DueTick >> (SlotBits * level)) & (SlotCount - 1));
+  Link(entry, static_cast<uint8_t>(level), slot);
+}
+
+void TimerWheel::MoveDown(uint8_t level, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept {
+  uint8_t slot = static_cast<uint8_t>((m_currentTick >> (SlotBits * level)) & (SlotCount - 1));
+
+  // Detach the slot first because entries of the top level may go back into it.
+  TimerWheelEntry *entry = m_slots[level][slot];
+  m_slots[level][slot] = nullptr;
+  m_occupiedSlots[level] &= ~(uint64_t{1} << slot);
+
+  while (entry) {
+    TimerWheelEntry *next = entry->m_next;
+    entry->m_prev = nullptr;
+    entry->m_next = nullptr;
+    entry->m_isLinked = false;
+    --m_size;
+    Place(entry, expired);
+    entry = next;
+  }
+}
+
+} // namespace Mso
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Mso {
+
+//! An item of the TimerWheel. The owner of the wheel derives its timers from it.
+struct TimerWheelEntry {
+  uint64_t DueTick{0};
+
+ private:
+  friend struct TimerWheel;
+  TimerWheelEntry *m_prev{nullptr};
+  TimerWheelEntry *m_next{nullptr};
+  uint8_t m_level{0};
+  uint8_t m_slot{0};
+  bool m_isLinked{false};
+};
+
+//! Hierarchical timer wheel with four levels of 64 slots.
+//! The level 0 slot is one tick, the level 1 slot is 64 ticks, and so on. An entry is placed in the
+//! lowest level where its due tick shares the higher bits with the current tick. When the current
+//! tick reaches a slot of a higher level, its entries are moved down. The top level wraps around,
+//! and entries that are due later than one turn of it are moved back into the same slot.
+//! Insert and Remove are O(1). Advance only visits the ticks where a slot fires or moves down.
+//! The wheel does not own the entries and it is not thread safe.
+struct TimerWheel {
+  //! Adds the entry. Returns false and does not add it if it is already due at the current tick.
+  bool Insert(TimerWheelEntry *entry) noexcept;
+
+  //! Removes the entry. Returns false if it is not in the wheel.
+  bool Remove(TimerWheelEntry *entry) noexcept;
+
+  //! Moves the current tick to nowTick and adds the entries that became due to the expired vector.
+  void Advance(uint64_t nowTick, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept;
+
+  //! The first tick after the current one where an entry is due or moves to a lower level.
+  std::optional<uint64_t> NextTick() const noexcept;
+
+  uint64_t CurrentTick() const noexcept;
+  size_t Size() const noexcept;
+
+ private:
+  void Link(TimerWheelEntry *entry, uint8_t level, uint8_t slot) noexcept;
+  void Unlink(TimerWheelEntry *entry) noexcept;
+  void Place(TimerWheelEntry *entry, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept;
+  void MoveDown(uint8_t level, /*out*/ std::vector<TimerWheelEntry *> &expired) noexcept;
+
+  constexpr static uint32_t SlotBits{6};
+  constexpr static uint32_t SlotCount{1 << SlotBits};
+  constexpr static uint32_t LevelCount{4};
+
+ private:
+  std::array<std::array<TimerWheelEntry *, SlotCount>, LevelCount> m_slots{};
+  std::array<uint64_t, LevelCount> m_occupiedSlots{}; // A bit per non-empty slot.
+  uint64_t m_currentTick{0};
+  size_t m_size{0};
+};
+
+} // namespace Mso
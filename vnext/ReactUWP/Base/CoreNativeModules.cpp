@@ -77,7 +77,11 @@ std::vector<facebook::react::NativeModuleDescription> GetCoreModules(
       NetworkingModule::Name, []() { return std::make_unique<NetworkingModule>(); }, MakeSerialQueueThread());
 
   modules.emplace_back(
-      "Timing", [messageQueue]() { return facebook::react::CreateTimingModule(messageQueue); }, messageQueue);
+      "Timing",
+      [messageQueue, devSettings]() {
+        return facebook::react::CreateTimingModule(messageQueue, devSettings->timerSlackMs, devSettings->timerStats);
+      },
+      messageQueue);
 
   modules.emplace_back(
       DeviceInfoModule::name, [deviceInfo]() { return std::make_unique<DeviceInfoModule>(deviceInfo); }, messageQueue);
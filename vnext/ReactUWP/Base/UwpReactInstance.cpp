@@ -84,7 +84,7 @@ void UwpReactInstance::Start(const std::shared_ptr<IReactInstance> &spThis, cons
 
   m_started = true;
   m_uiDispatcher = winrt::Windows::UI::Core::CoreWindow::GetForCurrentThread().Dispatcher();
-  m_defaultNativeThread = std::make_shared<react::uwp::UIMessageQueueThread>(m_uiDispatcher);
+  m_defaultNativeThread = std::make_shared<react::uwp::UIMessageQueueThread>(m_uiDispatcher, settings.UIQueueStats);
   m_batchingNativeThread = std::make_shared<react::uwp::BatchingUIMessageQueueThread>(m_uiDispatcher);
 
   // Objects that must be created on the UI thread
@@ -114,6 +114,8 @@ void UwpReactInstance::Start(const std::shared_ptr<IReactInstance> &spThis, cons
     devSettings->jsExceptionCallback = std::move(settings.JsExceptionCallback);
     devSettings->useJITCompilation = settings.EnableJITCompilation;
     devSettings->debugHost = settings.DebugHost;
+    devSettings->enableEventCoalescing = settings.EnableEventCoalescing;
+    devSettings->timerSlackMs = settings.TimerSlackMs;
 
     // In most cases, using the hardcoded ms-appx URI works fine, but there are
     // certain scenarios, such as in optional packaging, where the developer
@@ -166,6 +168,9 @@ void UwpReactInstance::Start(const std::shared_ptr<IReactInstance> &spThis, cons
 
     // Create NativeUIManager & UIManager
     m_uiManager = CreateUIManager(spThis, m_viewManagerProvider);
+    auto nativeUIManager = static_cast<NativeUIManager *>(m_uiManager->getNativeUIManager());
+    nativeUIManager->SetViewFlatteningEnabled(settings.EnableViewFlattening);
+    nativeUIManager->SetHitTestIndexEnabled(settings.EnableHitTestIndex);
 
     // Acquire default modules and then populate with custom modules
     std::vector<facebook::react::NativeModuleDescription> cxxModules = GetCoreModules(
@@ -185,7 +190,7 @@ void UwpReactInstance::Start(const std::shared_ptr<IReactInstance> &spThis, cons
       cxxModules.insert(std::end(cxxModules), std::begin(customCxxModules), std::end(customCxxModules));
     }
 
-    std::shared_ptr<facebook::react::MessageQueueThread> jsQueue = CreateAndStartJSQueueThread();
+    std::shared_ptr<facebook::react::MessageQueueThread> jsQueue = CreateAndStartJSQueueThread(settings.JSQueueStats);
 
 #ifdef PATCH_RN
     if (settings.UseJsi) {
@@ -80,6 +80,12 @@ class UwpReactInstance : public IReactInstance, public ::std::enable_shared_from
   ExpressionAnimationStore &GetExpressionAnimationStore() override {
     return m_expressionAnimationStore;
   }
+  void SetNativeAnimatedNodeManager(const std::shared_ptr<NativeAnimatedNodeManager> &manager) override {
+    m_nativeAnimatedNodeManager = manager;
+  }
+  std::shared_ptr<NativeAnimatedNodeManager> GetNativeAnimatedNodeManager() const override {
+    return m_nativeAnimatedNodeManager.lock();
+  }
   const ReactInstanceSettings &GetReactInstanceSettings() const override {
     return m_reactInstanceSettings;
   }
@@ -124,6 +130,7 @@ class UwpReactInstance : public IReactInstance, public ::std::enable_shared_from
   std::atomic_bool m_isWaitingForDebugger{false};
   std::string m_errorMessage;
   ExpressionAnimationStore m_expressionAnimationStore;
+  std::weak_ptr<NativeAnimatedNodeManager> m_nativeAnimatedNodeManager;
 
   std::function<void(XamlView)> m_xamlViewCreatedTestHook;
 
@@ -13,6 +13,7 @@ class NativeAnimatedNodeManager;
 class AnimatedNode {
  public:
   AnimatedNode(int64_t tag, const std::shared_ptr<NativeAnimatedNodeManager> &manager);
+  virtual ~AnimatedNode() = default;
   int64_t Tag();
   void AddChild(int64_t animatedNode);
   void RemoveChild(int64_t animatedNode);
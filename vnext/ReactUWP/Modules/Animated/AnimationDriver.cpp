@@ -5,6 +5,8 @@
 
 #include "AnimationDriver.h"
 
+#include <Tracing.h>
+
 namespace react {
 namespace uwp {
 
@@ -14,7 +16,12 @@ AnimationDriver::AnimationDriver(
     const Callback &endCallback,
     const folly::dynamic &config,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager)
-    : m_id(id), m_animatedValueTag(animatedValueTag), m_endCallback(endCallback), m_config(config), m_manager(manager) {
+    : m_id(id),
+      m_animatedValueTag(animatedValueTag),
+      m_endCallback(endCallback),
+      m_config(config),
+      m_manager(manager),
+      m_requestTime(std::chrono::steady_clock::now()) {
   m_iterations = [iterations = config.find("iterations"), end = config.items().end()]() {
     if (iterations != end) {
       return static_cast<int64_t>(iterations.dereference().second.asDouble());
@@ -39,6 +46,7 @@ void AnimationDriver::DoCallback(bool value) {
 AnimationDriver::~AnimationDriver() {
   if (m_scopedBatch)
     m_scopedBatch.Completed(m_scopedBatchCompletedToken);
+  ReportEnd(false);
 }
 
 void AnimationDriver::StartAnimation() {
@@ -54,8 +62,22 @@ void AnimationDriver::StartAnimation() {
   }
   scopedBatch.End();
 
+  m_startTime = std::chrono::steady_clock::now();
+  if (auto manager = m_manager.lock()) {
+    manager->GetAnimationStats().RecordStart(m_startTime - m_requestTime, m_keyframeCount);
+  }
+  // Animations overlap and end in the batch completion handler, so each one is
+  // an async section keyed by its id.
+  if (facebook::react::IsTracingEnabled()) {
+    const auto startLatency = std::chrono::duration_cast<std::chrono::microseconds>(m_startTime - m_requestTime);
+    const auto args = "id=" + std::to_string(m_id) + " keyframes=" + std::to_string(m_keyframeCount) +
+        " startLatencyUs=" + std::to_string(startLatency.count());
+    facebook::react::SystraceBeginAsyncSection(s_traceSectionName, static_cast<int>(m_id), args.c_str());
+  }
+
   m_scopedBatchCompletedToken = scopedBatch.Completed([&](auto sender, auto) {
     DoCallback(true);
+    ReportEnd(true);
     if (auto manager = m_manager.lock()) {
       if (auto const animatedValue = manager->GetValueAnimatedNode(m_animatedValueTag)) {
         animatedValue->RemoveActiveAnimation(m_id);
@@ -77,6 +99,7 @@ void AnimationDriver::StopAnimation(bool ignoreCompletedHandlers) {
 
       if (m_scopedBatch) {
         DoCallback(false);
+        ReportEnd(false);
         m_scopedBatch.Completed(m_scopedBatchCompletedToken);
         m_scopedBatch = nullptr;
       }
@@ -84,6 +107,40 @@ void AnimationDriver::StopAnimation(bool ignoreCompletedHandlers) {
   }
 }
 
+void AnimationDriver::SetKeyframeInfo(size_t keyframeCount, std::chrono::nanoseconds iterationDuration) {
+  m_keyframeCount = keyframeCount;
+  m_iterationDuration = iterationDuration;
+}
+
+void AnimationDriver::ReportEnd(bool finished) {
+  if (m_ended || m_startTime == std::chrono::steady_clock::time_point{}) {
+    return;
+  }
+  m_ended = true;
+
+  const auto duration = std::chrono::steady_clock::now() - m_startTime;
+  uint64_t droppedFrames = 0;
+  if (auto manager = m_manager.lock()) {
+    if (finished) {
+      // Looping animations never finish, so the iteration count is known here.
+      const auto frameInterval = std::chrono::duration<double>(manager->KeyframeSampling().frameInterval);
+      droppedFrames = facebook::react::CountDroppedFrames(
+          duration,
+          m_iterationDuration * std::max<int64_t>(m_iterations, 1),
+          std::chrono::duration_cast<std::chrono::nanoseconds>(frameInterval));
+      manager->GetAnimationStats().RecordFinish(duration, droppedFrames);
+    } else {
+      manager->GetAnimationStats().RecordStop();
+    }
+  }
+
+  if (facebook::react::IsTracingEnabled()) {
+    const auto args = "id=" + std::to_string(m_id) + (finished ? " finished" : " stopped") +
+        " droppedFrames=" + std::to_string(droppedFrames);
+    facebook::react::SystraceEndAsyncSection(s_traceSectionName, static_cast<int>(m_id), args.c_str(), duration);
+  }
+}
+
 ValueAnimatedNode *AnimationDriver::GetAnimatedValue() {
   if (auto manager = m_manager.lock()) {
     return manager->GetValueAnimatedNode(m_animatedValueTag);
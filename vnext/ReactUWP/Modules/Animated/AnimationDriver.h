@@ -3,6 +3,7 @@
 
 #pragma once
 #include <folly/dynamic.h>
+#include <chrono>
 #include "NativeAnimatedNodeManager.h"
 #include "ValueAnimatedNode.h"
 
@@ -55,6 +56,10 @@ class AnimationDriver {
  protected:
   ValueAnimatedNode *GetAnimatedValue();
 
+  // Called from MakeAnimation with the keyframes of one iteration, so that
+  // the animation can be reported by NativeAnimatedNodeManager::GetAnimationStats.
+  void SetKeyframeInfo(size_t keyframeCount, std::chrono::nanoseconds iterationDuration);
+
   int64_t m_id{0};
   int64_t m_animatedValueTag{};
   int64_t m_iterations{0};
@@ -70,6 +75,15 @@ class AnimationDriver {
  private:
   Callback m_endCallback{};
   void DoCallback(bool value);
+  void ReportEnd(bool finished);
+
+  std::chrono::steady_clock::time_point m_requestTime{};
+  std::chrono::steady_clock::time_point m_startTime{};
+  std::chrono::nanoseconds m_iterationDuration{0};
+  size_t m_keyframeCount{0};
+  bool m_ended{false};
+
+  static constexpr const char *s_traceSectionName{"NativeAnimation"};
 #ifdef DEBUG
   int m_debug_callbackAttempts{0};
 #endif // DEBUG
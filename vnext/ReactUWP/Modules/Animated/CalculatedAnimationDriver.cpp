@@ -20,29 +20,54 @@ std::tuple<winrt::CompositionAnimation, winrt::CompositionScopedBatch> Calculate
   }();
 
   m_startValue = GetAnimatedValue()->Value();
-  std::vector<float> keyFrames = [this]() {
-    std::vector<float> keyFrames;
-    bool done = false;
-    double time = 0;
-    while (!done) {
-      time += 1.0f / 60.0f;
-      auto [currentValue, currentVelocity] = GetValueAndVelocityForTime(time);
-      keyFrames.push_back(currentValue);
-      if (IsAnimationDone(currentValue, currentVelocity)) {
-        done = true;
-      }
+  const auto manager = m_manager.lock();
+  const auto samplingOptions = manager ? manager->KeyframeSampling() : facebook::react::KeyframeSamplingOptions{};
+
+  // Keyframes hold the offset from the start value divided by distance, so
+  // that curves of repeated animations can be shared through the cache.
+  std::vector<double> cacheKey;
+  double distance = 1.0;
+  const bool cacheable = manager && CurveCacheKey(cacheKey, distance) && distance != 0.0;
+  if (!cacheable) {
+    distance = 1.0;
+  }
+
+  const auto generateKeyFrames = [this, &samplingOptions, distance]() {
+    // Keyframes are only emitted where linear interpolation between them
+    // would stray from the curve by more than the sampling tolerance.
+    auto keyFrames = facebook::react::GenerateKeyframes(
+        [this](const double *times, size_t count, float *values, double *velocities) {
+          GetValuesAndVelocitiesForTimes(times, count, values, velocities);
+        },
+        [this](double value, double velocity) { return IsAnimationDone(value, velocity); },
+        SettleTime(),
+        samplingOptions);
+    for (auto &keyFrame : keyFrames) {
+      keyFrame.value = (keyFrame.value - m_startValue) / distance;
     }
     return keyFrames;
-  }();
+  };
+
+  facebook::react::KeyframeCache::Curve keyFrames;
+  if (cacheable) {
+    // The absolute tolerance is the only sampling option that does not scale
+    // with the distance. The cache is cleared when the options change.
+    cacheKey.push_back(samplingOptions.absoluteTolerance / std::abs(distance));
+    keyFrames = manager->GetKeyframeCache().GetOrCreate(cacheKey, generateKeyFrames);
+  } else {
+    keyFrames = std::make_shared<const std::vector<facebook::react::Keyframe>>(generateKeyFrames());
+  }
 
-  std::chrono::milliseconds duration(static_cast<int>(keyFrames.size() / 60.0f * 1000.0f));
+  const auto totalTime = keyFrames->back().time;
+  std::chrono::milliseconds duration(static_cast<int>(totalTime * 1000.0));
   animation.Duration(duration);
-  auto normalizedProgress = 0.0f;
+  SetKeyframeInfo(keyFrames->size(), duration);
   // We are animating the values offset property which should start at 0.
-  animation.InsertKeyFrame(normalizedProgress, 0.0f, easingFunction);
-  for (const auto keyFrame : keyFrames) {
-    normalizedProgress = std::min(normalizedProgress + 1.0f / keyFrames.size(), 1.0f);
-    animation.InsertKeyFrame(normalizedProgress, keyFrame - static_cast<float>(m_startValue), easingFunction);
+  animation.InsertKeyFrame(0.0f, 0.0f, easingFunction);
+  for (size_t i = 1; i < keyFrames->size(); ++i) {
+    const auto &keyFrame = (*keyFrames)[i];
+    const auto normalizedProgress = std::min(static_cast<float>(keyFrame.time / totalTime), 1.0f);
+    animation.InsertKeyFrame(normalizedProgress, static_cast<float>(keyFrame.value * distance), easingFunction);
   }
 
   if (m_iterations == -1) {
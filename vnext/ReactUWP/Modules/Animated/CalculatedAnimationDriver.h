@@ -2,7 +2,10 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <Animated/AnimationCurves.h>
 #include <folly/dynamic.h>
+#include <limits>
+#include <tuple>
 #include <utility>
 #include "AnimatedNode.h"
 #include "AnimationDriver.h"
@@ -19,7 +22,27 @@ class CalculatedAnimationDriver : public AnimationDriver {
  protected:
   virtual std::tuple<float, double> GetValueAndVelocityForTime(double time) = 0;
 
+  // Batch version of GetValueAndVelocityForTime, for drivers with a
+  // vectorized curve.
+  virtual void GetValuesAndVelocitiesForTimes(const double *times, size_t count, float *values, double *velocities) {
+    for (size_t i = 0; i < count; ++i) {
+      std::tie(values[i], velocities[i]) = GetValueAndVelocityForTime(times[i]);
+    }
+  }
+
   virtual bool IsAnimationDone(double currentValue, double currentVelocity) = 0;
+
+  // Upper bound on the time the curve needs to come to rest, in seconds.
+  virtual double SettleTime() {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  // Fills key with the parameters that determine the curve once its offsets
+  // are divided by distance. Returns false if the curve cannot be cached.
+  virtual bool CurveCacheKey(std::vector<double> & /*key*/, double & /*distance*/) {
+    return false;
+  }
+
   double m_startValue{0};
 };
 } // namespace uwp
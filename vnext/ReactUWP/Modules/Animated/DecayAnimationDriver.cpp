@@ -3,7 +3,9 @@
 
 #include "pch.h"
 
+#include <Animated/CurveKernels.h>
 #include <math.h>
+#include "AnimationType.h"
 #include "DecayAnimationDriver.h"
 
 namespace react {
@@ -21,14 +23,36 @@ DecayAnimationDriver::DecayAnimationDriver(
 }
 
 std::tuple<float, double> DecayAnimationDriver::GetValueAndVelocityForTime(double time) {
-  const auto value =
-      m_startValue + m_velocity / (1 - m_deceleration) * (1 - std::exp(-(1 - m_deceleration) * (1000 * time)));
+  const auto value = facebook::react::DecayValue(m_startValue, m_velocity, m_deceleration, time);
   return std::make_tuple(static_cast<float>(value),
                          42.0f); // we don't need the velocity, so set it to a dummy value
 }
 
+void DecayAnimationDriver::GetValuesAndVelocitiesForTimes(
+    const double *times,
+    size_t count,
+    float *values,
+    double *velocities) {
+  std::vector<double> decayValues(count);
+  facebook::react::DecayValues(m_startValue, m_velocity, m_deceleration, times, count, decayValues.data());
+  for (size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<float>(decayValues[i]);
+    velocities[i] = 42.0f; // we don't need the velocity, so set it to a dummy value
+  }
+}
+
 bool DecayAnimationDriver::IsAnimationDone(double currentValue, double /*currentVelocity*/) {
-  return (std::abs(ToValue() - currentValue) < 0.1);
+  return (std::abs(ToValue() - currentValue) < s_restThreshold);
+}
+
+double DecayAnimationDriver::SettleTime() {
+  return facebook::react::EstimateDecaySettleTime(m_velocity, m_deceleration, s_restThreshold);
+}
+
+bool DecayAnimationDriver::CurveCacheKey(std::vector<double> &key, double &distance) {
+  distance = m_velocity / (1 - m_deceleration);
+  key = {static_cast<double>(AnimationType::Decay), m_deceleration, s_restThreshold / std::abs(distance)};
+  return true;
 }
 
 double DecayAnimationDriver::ToValue() {
@@ -21,12 +21,17 @@ class DecayAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
+  void GetValuesAndVelocitiesForTimes(const double *times, size_t count, float *values, double *velocities) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
+  double SettleTime() override;
+  bool CurveCacheKey(std::vector<double> &key, double &distance) override;
 
  private:
   double m_velocity{0};
   double m_deceleration{0};
 
+  static constexpr double s_restThreshold{0.1};
+
   static constexpr std::string_view s_velocityName{"velocity"};
   static constexpr std::string_view s_decelerationName{"deceleration"};
 
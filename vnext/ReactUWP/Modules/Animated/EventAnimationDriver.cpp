@@ -16,6 +16,7 @@ EventAnimationDriver::EventAnimationDriver(
   for (const auto &path : eventPath) {
     m_eventPath.push_back(path.getString());
   }
+  m_nativeEventField = facebook::react::CompileNativeEventPath(m_eventPath);
 }
 
 ValueAnimatedNode *EventAnimationDriver::AnimatedValue() {
@@ -25,5 +26,22 @@ ValueAnimatedNode *EventAnimationDriver::AnimatedValue() {
   return static_cast<ValueAnimatedNode *>(nullptr);
 }
 
+bool EventAnimationDriver::UpdateFromNativeEvent(const facebook::react::NativeAnimatedEvent &event) {
+  if (!m_nativeEventField) {
+    return false;
+  }
+
+  const auto value = event.Get(*m_nativeEventField);
+  if (!value) {
+    return false;
+  }
+
+  if (const auto animatedValue = AnimatedValue()) {
+    animatedValue->RawValue(*value);
+    return true;
+  }
+  return false;
+}
+
 } // namespace uwp
 } // namespace react
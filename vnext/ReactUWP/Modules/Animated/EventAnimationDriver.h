@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <Animated/NativeAnimatedEvent.h>
 #include <folly/dynamic.h>
 #include "AnimatedNode.h"
 #include "ValueAnimatedNode.h"
@@ -16,9 +17,14 @@ class EventAnimationDriver {
       int64_t animatedValueTag,
       const std::shared_ptr<NativeAnimatedNodeManager> &manager);
   ValueAnimatedNode *AnimatedValue();
+  // Sets the animated value to the field the event path selects. Returns
+  // false if the event does not carry that field.
+  bool UpdateFromNativeEvent(const facebook::react::NativeAnimatedEvent &event);
 
  private:
   std::vector<std::string> m_eventPath{};
+  // The event path, resolved once at registration.
+  std::optional<facebook::react::NativeEventField> m_nativeEventField{};
   int64_t m_animatedValueTag{};
   std::weak_ptr<NativeAnimatedNodeManager> m_manager{};
 };
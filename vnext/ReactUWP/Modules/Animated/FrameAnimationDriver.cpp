@@ -41,6 +41,7 @@ std::tuple<winrt::CompositionAnimation, winrt::CompositionScopedBatch> FrameAnim
     normalizedProgress = std::min(normalizedProgress += step, 1.0f);
     animation.InsertKeyFrame(normalizedProgress, static_cast<float>(frame * (m_toValue - fromValue)));
   }
+  SetKeyframeInfo(m_frames.size(), duration);
 
   if (m_iterations == -1) {
     animation.IterationBehavior(winrt::AnimationIterationBehavior::Forever);
@@ -32,7 +32,10 @@ const char *NativeAnimatedModule::s_stopListeningToAnimatedNodeValueName{"stopLi
 
 NativeAnimatedModule::NativeAnimatedModule(const std::weak_ptr<IReactInstance> &reactInstance)
     : m_wkReactInstance(reactInstance) {
-  m_nodesManager = std::make_shared<NativeAnimatedNodeManager>(NativeAnimatedNodeManager());
+  m_nodesManager = std::make_shared<NativeAnimatedNodeManager>();
+  if (const auto instance = reactInstance.lock()) {
+    instance->SetNativeAnimatedNodeManager(m_nodesManager);
+  }
 }
 
 std::vector<facebook::xplat::module::CxxModule::Method> NativeAnimatedModule::getMethods() {
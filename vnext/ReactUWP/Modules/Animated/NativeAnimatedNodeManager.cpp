@@ -32,59 +32,58 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
     const folly::dynamic &config,
     const std::weak_ptr<IReactInstance> &instance,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
-  if (m_transformNodes.count(tag) > 0 || m_propsNodes.count(tag) > 0 || m_styleNodes.count(tag) > 0 ||
-      m_valueNodes.count(tag) > 0) {
+  if (FindNode(tag)) {
     throw std::invalid_argument("AnimatedNode with tag " + std::to_string(tag) + " already exists.");
     return;
   }
 
   switch (const auto type = AnimatedNodeTypeFromString(config.find("type").dereference().second.getString())) {
     case AnimatedNodeType::Style: {
-      m_styleNodes.emplace(tag, std::make_unique<StyleAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Style, std::make_unique<StyleAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Value: {
-      m_valueNodes.emplace(tag, std::make_unique<ValueAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<ValueAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Props: {
-      m_propsNodes.emplace(tag, std::make_unique<PropsAnimatedNode>(tag, config, instance, manager));
+      AddNode(tag, NodeKind::Props, std::make_unique<PropsAnimatedNode>(tag, config, instance, manager));
       break;
     }
     case AnimatedNodeType::Interpolation: {
-      m_valueNodes.emplace(tag, std::make_unique<InterpolationAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<InterpolationAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Addition: {
-      m_valueNodes.emplace(tag, std::make_unique<AdditionAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<AdditionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Subtraction: {
-      m_valueNodes.emplace(tag, std::make_unique<SubtractionAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<SubtractionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Division: {
-      m_valueNodes.emplace(tag, std::make_unique<DivisionAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<DivisionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Multiplication: {
-      m_valueNodes.emplace(tag, std::make_unique<MultiplicationAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<MultiplicationAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Modulus: {
-      m_valueNodes.emplace(tag, std::make_unique<ModulusAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<ModulusAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Diffclamp: {
-      m_valueNodes.emplace(tag, std::make_unique<DiffClampAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Value, std::make_unique<DiffClampAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Transform: {
-      m_transformNodes.emplace(tag, std::make_unique<TransformAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Transform, std::make_unique<TransformAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Tracking: {
-      m_trackingNodes.emplace(tag, std::make_unique<TrackingAnimatedNode>(tag, config, manager));
+      AddNode(tag, NodeKind::Tracking, std::make_unique<TrackingAnimatedNode>(tag, config, manager));
       break;
     }
     default: {
@@ -95,11 +94,11 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->ConnectToView(viewTag);
+  NodeAt<PropsAnimatedNode>(propsNodeTag, NodeKind::Props).ConnectToView(viewTag);
 }
 
 void NativeAnimatedNodeManager::DisconnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->DisconnectFromView(viewTag);
+  NodeAt<PropsAnimatedNode>(propsNodeTag, NodeKind::Props).DisconnectFromView(viewTag);
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
@@ -247,34 +246,25 @@ void NativeAnimatedNodeManager::StartAnimatingNode(
 }
 
 void NativeAnimatedNodeManager::DropAnimatedNode(int64_t tag) {
-  m_valueNodes.erase(tag);
-  m_propsNodes.erase(tag);
-  m_styleNodes.erase(tag);
-  m_transformNodes.erase(tag);
+  if (const auto entry = FindNode(tag)) {
+    *entry = NodeEntry{};
+  }
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeValue(int64_t tag, double value) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
-    valueNode->RawValue(static_cast<float>(value));
-  }
+  NodeAt<ValueAnimatedNode>(tag, NodeKind::Value).RawValue(static_cast<float>(value));
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeOffset(int64_t tag, double offset) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
-    valueNode->Offset(static_cast<float>(offset));
-  }
+  NodeAt<ValueAnimatedNode>(tag, NodeKind::Value).Offset(static_cast<float>(offset));
 }
 
 void NativeAnimatedNodeManager::FlattenAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
-    valueNode->FlattenOffset();
-  }
+  NodeAt<ValueAnimatedNode>(tag, NodeKind::Value).FlattenOffset();
 }
 
 void NativeAnimatedNodeManager::ExtractAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
-    valueNode->ExtractOffset();
-  }
+  NodeAt<ValueAnimatedNode>(tag, NodeKind::Value).ExtractOffset();
 }
 
 void NativeAnimatedNodeManager::AddAnimatedEventToView(
@@ -285,21 +275,20 @@ void NativeAnimatedNodeManager::AddAnimatedEventToView(
   const auto valueNodeTag = static_cast<int64_t>(eventMapping.find("animatedValueTag").dereference().second.asDouble());
   const auto pathList = eventMapping.find("nativeEventPath").dereference().second;
 
-  const auto key = std::make_tuple(viewTag, eventName);
-  if (m_eventDrivers.count(key)) {
-    m_eventDrivers.at(key).emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
-  } else {
-    auto vector = std::vector<std::unique_ptr<EventAnimationDriver>>{};
-    vector.emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
-    m_eventDrivers.insert({key, std::move(vector)});
-  }
+  const auto key = EventDriverKey{viewTag, InternEventName(eventName)};
+  m_eventDrivers[key].emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
 }
 
 void NativeAnimatedNodeManager::RemoveAnimatedEventFromView(
     int64_t viewTag,
     const std::string &eventName,
     int64_t animatedValueTag) {
-  const auto key = std::make_tuple(viewTag, eventName);
+  const auto eventNameId = FindEventNameId(eventName);
+  if (!eventNameId) {
+    return;
+  }
+
+  const auto key = EventDriverKey{viewTag, *eventNameId};
   if (m_eventDrivers.count(key)) {
     auto &drivers = m_eventDrivers.at(key);
 
@@ -326,8 +315,8 @@ void NativeAnimatedNodeManager::ProcessDelayedPropsNodes() {
   const auto delayedPropsNodes = m_delayedPropsNodes;
   m_delayedPropsNodes.clear();
   for (const auto tag : delayedPropsNodes) {
-    if (m_propsNodes.count(tag) > 0) {
-      m_propsNodes.at(tag)->StartAnimations();
+    if (const auto propsNode = GetPropsAnimatedNode(tag)) {
+      propsNode->StartAnimations();
     }
   }
 }
@@ -343,58 +332,105 @@ void NativeAnimatedNodeManager::AddDelayedPropsNode(
   }
 }
 
-AnimatedNode *NativeAnimatedNodeManager::GetAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
+NativeAnimatedNodeManager::EventNameId NativeAnimatedNodeManager::InternEventName(const std::string &eventName) {
+  if (const auto eventNameId = FindEventNameId(eventName)) {
+    return *eventNameId;
   }
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
+
+  m_eventNames.push_back(eventName);
+  return static_cast<EventNameId>(m_eventNames.size() - 1);
+}
+
+std::optional<NativeAnimatedNodeManager::EventNameId> NativeAnimatedNodeManager::FindEventNameId(
+    const std::string &eventName) const {
+  for (size_t i = 0; i < m_eventNames.size(); ++i) {
+    if (m_eventNames[i] == eventName) {
+      return static_cast<EventNameId>(i);
+    }
   }
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
+  return std::nullopt;
+}
+
+bool NativeAnimatedNodeManager::DispatchNativeEvent(
+    int64_t viewTag,
+    std::string_view topLevelEventName,
+    const facebook::react::NativeAnimatedEvent &event) {
+  if (m_eventDrivers.empty() || topLevelEventName.substr(0, 3) != "top") {
+    return false;
   }
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
+
+  // Match "onScroll" against "topScroll" in place, without building a string.
+  const auto baseName = topLevelEventName.substr(3);
+  const std::vector<std::unique_ptr<EventAnimationDriver>> *drivers = nullptr;
+  for (size_t i = 0; i < m_eventNames.size() && !drivers; ++i) {
+    const std::string_view eventName = m_eventNames[i];
+    if (eventName.substr(0, 2) == "on" && eventName.substr(2) == baseName) {
+      drivers = GetEventDrivers(viewTag, static_cast<EventNameId>(i));
+    }
   }
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
+
+  if (!drivers) {
+    return false;
   }
-  return static_cast<AnimatedNode *>(nullptr);
+
+  bool updated = false;
+  for (const auto &driver : *drivers) {
+    updated |= driver->UpdateFromNativeEvent(event);
+  }
+  return updated;
 }
 
-ValueAnimatedNode *NativeAnimatedNodeManager::GetValueAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
+const std::vector<std::unique_ptr<EventAnimationDriver>> *NativeAnimatedNodeManager::GetEventDrivers(
+    int64_t viewTag,
+    EventNameId eventNameId) {
+  const auto drivers = m_eventDrivers.find(EventDriverKey{viewTag, eventNameId});
+  return drivers != m_eventDrivers.end() ? &drivers->second : nullptr;
+}
+
+void NativeAnimatedNodeManager::AddNode(int64_t tag, NodeKind kind, std::unique_ptr<AnimatedNode> node) {
+  if (tag < 0) {
+    throw std::invalid_argument("AnimatedNode tag " + std::to_string(tag) + " is negative.");
   }
-  return static_cast<ValueAnimatedNode *>(nullptr);
+
+  const auto index = static_cast<size_t>(tag);
+  if (index >= m_nodes.size()) {
+    m_nodes.resize(std::max(index + 1, m_nodes.size() * 2));
+  }
+  m_nodes[index] = NodeEntry{std::move(node), kind};
 }
 
-PropsAnimatedNode *NativeAnimatedNodeManager::GetPropsAnimatedNode(int64_t tag) {
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
+NativeAnimatedNodeManager::NodeEntry *NativeAnimatedNodeManager::FindNode(int64_t tag) {
+  if (tag < 0 || static_cast<uint64_t>(tag) >= m_nodes.size()) {
+    return nullptr;
   }
-  return static_cast<PropsAnimatedNode *>(nullptr);
+
+  auto &entry = m_nodes[static_cast<size_t>(tag)];
+  return entry.node ? &entry : nullptr;
+}
+
+AnimatedNode *NativeAnimatedNodeManager::GetAnimatedNode(int64_t tag) {
+  const auto entry = FindNode(tag);
+  return entry ? entry->node.get() : nullptr;
+}
+
+ValueAnimatedNode *NativeAnimatedNodeManager::GetValueAnimatedNode(int64_t tag) {
+  return GetNode<ValueAnimatedNode>(tag, NodeKind::Value);
+}
+
+PropsAnimatedNode *NativeAnimatedNodeManager::GetPropsAnimatedNode(int64_t tag) {
+  return GetNode<PropsAnimatedNode>(tag, NodeKind::Props);
 }
 
 StyleAnimatedNode *NativeAnimatedNodeManager::GetStyleAnimatedNode(int64_t tag) {
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
-  }
-  return static_cast<StyleAnimatedNode *>(nullptr);
+  return GetNode<StyleAnimatedNode>(tag, NodeKind::Style);
 }
 
 TransformAnimatedNode *NativeAnimatedNodeManager::GetTransformAnimatedNode(int64_t tag) {
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
-  }
-  return static_cast<TransformAnimatedNode *>(nullptr);
+  return GetNode<TransformAnimatedNode>(tag, NodeKind::Transform);
 }
 
 TrackingAnimatedNode *NativeAnimatedNodeManager::GetTrackingAnimatedNode(int64_t tag) {
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
-  }
-  return nullptr;
+  return GetNode<TrackingAnimatedNode>(tag, NodeKind::Tracking);
 }
 
 void NativeAnimatedNodeManager::RemoveActiveAnimation(int64_t tag) {
@@ -4,9 +4,17 @@
 // Copyright (c) 2015-present, Facebook, Inc.
 // Licensed under the MIT License.
 
+#include <Animated/AnimationCurves.h>
+#include <Animated/AnimationStats.h>
+#include <Animated/KeyframeCache.h>
+#include <Animated/NativeAnimatedEvent.h>
 #include <IReactInstance.h>
 #include <cxxreact/CxxModule.h>
 #include <folly/dynamic.h>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include "AnimatedNode.h"
 #include "AnimationDriver.h"
 #include "EventAnimationDriver.h"
@@ -82,6 +90,22 @@ class NativeAnimatedNodeManager {
   void ProcessDelayedPropsNodes();
   void AddDelayedPropsNode(int64_t propsNodeTag, const std::shared_ptr<IReactInstance> &instance);
 
+  // Event names are interned to small ids, so that event drivers are found
+  // without hashing strings.
+  using EventNameId = uint32_t;
+  EventNameId InternEventName(const std::string &eventName);
+  const std::vector<std::unique_ptr<EventAnimationDriver>> *GetEventDrivers(int64_t viewTag, EventNameId eventNameId);
+
+  // Called by views on the UI thread to update the values bound with
+  // Animated.event in the same frame, without serializing the event or
+  // waiting for JS. topLevelEventName is the name the view raises to JS
+  // ("topScroll"), which Animated.event registers as "onScroll". Returns
+  // whether any value was updated.
+  bool DispatchNativeEvent(
+      int64_t viewTag,
+      std::string_view topLevelEventName,
+      const facebook::react::NativeAnimatedEvent &event);
+
   AnimatedNode *GetAnimatedNode(int64_t tag);
   ValueAnimatedNode *GetValueAnimatedNode(int64_t tag);
   PropsAnimatedNode *GetPropsAnimatedNode(int64_t tag);
@@ -90,17 +114,96 @@ class NativeAnimatedNodeManager {
   TrackingAnimatedNode *GetTrackingAnimatedNode(int64_t tag);
   void RemoveActiveAnimation(int64_t tag);
 
+  // Controls how calculated (spring, decay) animations are turned into
+  // composition keyframes.
+  const facebook::react::KeyframeSamplingOptions &KeyframeSampling() const {
+    return m_keyframeSampling;
+  }
+  void SetKeyframeSampling(const facebook::react::KeyframeSamplingOptions &options) {
+    m_keyframeSampling = options;
+    m_keyframeCache.Clear();
+  }
+
+  // Normalized keyframe curves shared by repeated spring, decay and frame
+  // animations.
+  facebook::react::KeyframeCache &GetKeyframeCache() {
+    return m_keyframeCache;
+  }
+  facebook::react::KeyframeCacheStats GetKeyframeCacheStats() const {
+    return m_keyframeCache.GetStats();
+  }
+
+  // Start latency, duration, dropped frames and keyframe counts of the
+  // animations started since the last reset. May be polled from any thread.
+  facebook::react::AnimationStats &GetAnimationStats() {
+    return m_animationStats;
+  }
+  facebook::react::AnimationStatsSnapshot GetAnimationStatsSnapshot() const {
+    return m_animationStats.GetSnapshot();
+  }
+
  private:
-  std::unordered_map<int64_t, std::unique_ptr<ValueAnimatedNode>> m_valueNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<PropsAnimatedNode>> m_propsNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<StyleAnimatedNode>> m_styleNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TransformAnimatedNode>> m_transformNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TrackingAnimatedNode>> m_trackingNodes{};
-  std::unordered_map<std::tuple<int64_t, std::string>, std::vector<std::unique_ptr<EventAnimationDriver>>>
+  enum class NodeKind : uint8_t {
+    None,
+    Value,
+    Props,
+    Style,
+    Transform,
+    Tracking,
+  };
+
+  struct NodeEntry {
+    std::unique_ptr<AnimatedNode> node{};
+    NodeKind kind{NodeKind::None};
+  };
+
+  struct EventDriverKey {
+    int64_t viewTag;
+    EventNameId eventNameId;
+
+    bool operator==(const EventDriverKey &other) const {
+      return viewTag == other.viewTag && eventNameId == other.eventNameId;
+    }
+  };
+
+  struct EventDriverKeyHash {
+    size_t operator()(const EventDriverKey &key) const {
+      return std::hash<int64_t>()(key.viewTag) ^ (std::hash<uint32_t>()(key.eventNameId) << 1);
+    }
+  };
+
+  std::optional<EventNameId> FindEventNameId(const std::string &eventName) const;
+  void AddNode(int64_t tag, NodeKind kind, std::unique_ptr<AnimatedNode> node);
+  NodeEntry *FindNode(int64_t tag);
+
+  template <typename T>
+  T *GetNode(int64_t tag, NodeKind kind) {
+    const auto entry = FindNode(tag);
+    return entry && entry->kind == kind ? static_cast<T *>(entry->node.get()) : nullptr;
+  }
+
+  template <typename T>
+  T &NodeAt(int64_t tag, NodeKind kind) {
+    if (const auto node = GetNode<T>(tag, kind)) {
+      return *node;
+    }
+    throw std::out_of_range("No AnimatedNode of the expected type with tag " + std::to_string(tag) + ".");
+  }
+
+  // Indexed by tag. Tags come from a counter in Animated.js, so the table is
+  // dense; node objects are owned separately and keep their address.
+  std::vector<NodeEntry> m_nodes{};
+  // Indexed by EventNameId. Only a handful of event names are ever bound, so
+  // they are compared in place rather than hashed.
+  std::vector<std::string> m_eventNames{};
+  std::unordered_map<EventDriverKey, std::vector<std::unique_ptr<EventAnimationDriver>>, EventDriverKeyHash>
       m_eventDrivers{};
   std::unordered_map<int64_t, std::unique_ptr<AnimationDriver>> m_activeAnimations{};
   std::vector<std::tuple<int64_t, int64_t>> m_trackingAndLeadNodeTags{};
   std::vector<int64_t> m_delayedPropsNodes{};
+  facebook::react::KeyframeSamplingOptions m_keyframeSampling{};
+  facebook::react::KeyframeCache m_keyframeCache{};
+  facebook::react::AnimationStats m_animationStats{};
 
   static constexpr std::string_view s_toValueIdName{"toValue"};
   static constexpr std::string_view s_framesName{"frames"};
@@ -3,8 +3,10 @@
 
 #include "pch.h"
 
+#include <Animated/CurveKernels.h>
 #include <jsi/jsi.h>
 #include <math.h>
+#include "AnimationType.h"
 #include "SpringAnimationDriver.h"
 
 namespace react {
@@ -44,31 +46,50 @@ std::tuple<float, double> SpringAnimationDriver::GetValueAndVelocityForTime(doub
     }
     return m_endValue;
   }();
-  const auto c = m_springDamping;
-  const auto m = m_springMass;
-  const auto k = m_springStiffness;
-  const auto v0 = -m_initialVelocity;
+  return facebook::react::SpringValueAndVelocity(Parameters(), toValue, time);
+}
 
-  const auto zeta = c / (2 * std::sqrt(k * m));
-  const auto omega0 = std::sqrt(k / m);
-  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
-  const auto x0 = toValue - m_startValue;
+void SpringAnimationDriver::GetValuesAndVelocitiesForTimes(
+    const double *times,
+    size_t count,
+    float *values,
+    double *velocities) {
+  if (!m_dynamicToValues.empty()) {
+    CalculatedAnimationDriver::GetValuesAndVelocitiesForTimes(times, count, values, velocities);
+    return;
+  }
+  facebook::react::SpringValuesAndVelocities(Parameters(), times, count, values, velocities);
+}
 
-  if (zeta < 1) {
-    const auto envelope = std::exp(-zeta * omega0 * time);
-    const auto value = static_cast<float>(
-        toValue -
-        envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time)));
-    const auto velocity = zeta * omega0 * envelope *
-            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
-        envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
-    return std::make_tuple(value, velocity);
-  } else {
-    const auto envelope = std::exp(-omega0 * time);
-    const auto value = static_cast<float>(m_endValue - envelope * (x0 + (v0 + omega0 * x0) * time));
-    const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
-    return std::make_tuple(value, velocity);
+double SpringAnimationDriver::SettleTime() {
+  // Intermediate targets from dynamicToValues move the spring's rest point.
+  if (!m_dynamicToValues.empty()) {
+    return std::numeric_limits<double>::infinity();
   }
+  return facebook::react::EstimateSpringSettleTime(
+      Parameters(), m_restSpeedThreshold, m_displacementFromRestThreshold);
+}
+
+bool SpringAnimationDriver::CurveCacheKey(std::vector<double> &key, double &distance) {
+  if (!m_dynamicToValues.empty()) {
+    return false;
+  }
+
+  // Divided by the distance, the curve only depends on these.
+  distance = m_endValue - m_startValue;
+  key = {static_cast<double>(AnimationType::Spring),
+         m_springStiffness,
+         m_springDamping,
+         m_springMass,
+         m_initialVelocity / distance,
+         m_restSpeedThreshold / std::abs(distance),
+         m_displacementFromRestThreshold / std::abs(distance),
+         m_overshootClampingEnabled ? 1.0 : 0.0};
+  return true;
+}
+
+facebook::react::SpringParameters SpringAnimationDriver::Parameters() {
+  return {m_springStiffness, m_springDamping, m_springMass, m_initialVelocity, m_startValue, m_endValue};
 }
 
 bool SpringAnimationDriver::IsAtRest(double currentVelocity, double currentValue, double endValue) {
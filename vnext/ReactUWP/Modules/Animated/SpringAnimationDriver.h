@@ -23,9 +23,13 @@ class SpringAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
+  void GetValuesAndVelocitiesForTimes(const double *times, size_t count, float *values, double *velocities) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
+  double SettleTime() override;
+  bool CurveCacheKey(std::vector<double> &key, double &distance) override;
 
  private:
+  facebook::react::SpringParameters Parameters();
   bool IsAtRest(double currentVelocity, double currentPosition, double endValue);
   bool IsOvershooting(double currentValue);
 
@@ -9,10 +9,14 @@
 #include <Views/ShadowNodeBase.h>
 
 #include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.UI.Composition.h>
 #include <winrt/Windows.UI.Xaml.Controls.h>
 #include <winrt/Windows.UI.Xaml.Media.h>
 #include "Unicode.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace winrt {
 using namespace Windows::Foundation;
 using namespace Windows::UI;
@@ -193,8 +197,23 @@ void NativeUIManager::AddRootView(
   element.Tag(winrt::PropertyValue::CreateInt64(shadowNode.m_tag));
 
   // Add listener to size change so we can redo the layout when that happens
-  m_sizeChangedVector.push_back(
-      view.as<winrt::FrameworkElement>().SizeChanged(winrt::auto_revoke, [this](auto &&, auto &&) { DoLayout(); }));
+  m_sizeChangedVector.push_back(view.as<winrt::FrameworkElement>().SizeChanged(
+      winrt::auto_revoke, [this](auto &&, auto &&) { ScheduleLayoutForNextFrame(); }));
+}
+
+void NativeUIManager::ScheduleLayoutForNextFrame() {
+  // During a window resize SizeChanged fires many times per frame. Only lay
+  // out once, on the next rendering tick.
+  if (m_rendering) {
+    ++m_skippedLayoutPassCount;
+    return;
+  }
+
+  m_rendering = winrt::CompositionTarget::Rendering(winrt::auto_revoke, [this](auto &&, auto &&) { DoLayout(); });
+}
+
+uint64_t NativeUIManager::GetSkippedLayoutPassCount() const noexcept {
+  return m_skippedLayoutPassCount;
 }
 
 void NativeUIManager::destroy() {
@@ -203,6 +222,7 @@ void NativeUIManager::destroy() {
 
 void NativeUIManager::removeRootView(facebook::react::ShadowNode &shadow) {
   m_tagsToXamlReactControl.erase(shadow.m_tag);
+  m_hitTestIndex.RemoveRoot(shadow.m_tag);
   RemoveView(shadow, true);
 }
 
@@ -709,6 +729,84 @@ static void StyleYogaNode(ShadowNodeBase &shadowNode, const YGNodeRef yogaNode,
   }
 }
 
+// Props that only feed Yoga. A View that carries nothing else renders nothing
+// and does not need a XAML element of its own.
+static bool IsLayoutOnlyProp(const std::string &key, const folly::dynamic &value) {
+  static const std::unordered_set<std::string> s_layoutOnlyProps = {
+      "alignContent", "alignItems", "alignSelf", "aspectRatio", "bottom", "direction", "end", "flex", "flexBasis",
+      "flexDirection", "flexGrow", "flexShrink", "flexWrap", "height", "justifyContent", "left", "margin",
+      "marginBottom", "marginEnd", "marginHorizontal", "marginLeft", "marginRight", "marginStart", "marginTop",
+      "marginVertical", "maxHeight", "maxWidth", "minHeight", "minWidth", "padding", "paddingBottom", "paddingEnd",
+      "paddingHorizontal", "paddingLeft", "paddingRight", "paddingStart", "paddingTop", "paddingVertical", "position",
+      "right", "start", "top", "width"};
+
+  if (key == "collapsable")
+    return !value.isBool() || value.getBool();
+
+  // overflow: hidden clips, which needs a real panel
+  if (key == "overflow")
+    return value.isNull() || value == "visible";
+
+  // display: none has to hide the children, which live in another panel
+  if (key == "display")
+    return value.isNull() || value == "flex";
+
+  return s_layoutOnlyProps.find(key) != s_layoutOnlyProps.end();
+}
+
+bool NativeUIManager::isLayoutOnlyView(const std::string &className, const folly::dynamic &props) {
+  if (!m_viewFlatteningEnabled || className != "RCTView")
+    return false;
+
+  if (props.isNull())
+    return true;
+
+  for (const auto &pair : props.items()) {
+    if (!IsLayoutOnlyProp(pair.first.getString(), pair.second))
+      return false;
+  }
+
+  return true;
+}
+
+bool NativeUIManager::canHostLayoutOnlyChildren(facebook::react::ShadowNode &nativeParent) {
+  // Only panels that position their children by Yoga layout can host the
+  // children of a flattened view.
+  return nativeParent.m_className == "RCTView" || nativeParent.m_className == "ROOT";
+}
+
+void NativeUIManager::OnLayoutOnlyViewPromoted(facebook::react::ShadowNode &shadowNode) {
+  // The new view and the views that were flattened into its ancestor need their
+  // frames applied again, relative to the new view.
+  if (YGNodeRef yogaNode = GetYogaNode(shadowNode.m_tag)) {
+    YGNodeSetHasNewLayout(yogaNode, true);
+    MarkFlattenedChildrenHaveNewLayout(shadowNode);
+  }
+
+  // Outside of a batch the promotion was requested by measure, focus or a
+  // command, which expect the view to be laid out already.
+  if (!m_inBatch) {
+    DoLayout();
+    if (auto element = static_cast<ShadowNodeBase &>(shadowNode).GetView().try_as<winrt::UIElement>())
+      element.UpdateLayout();
+  }
+}
+
+void NativeUIManager::MarkFlattenedChildrenHaveNewLayout(facebook::react::ShadowNode &shadowNode) {
+  for (int64_t childTag : shadowNode.m_children) {
+    if (YGNodeRef yogaNode = GetYogaNode(childTag))
+      YGNodeSetHasNewLayout(yogaNode, true);
+
+    auto &childNode = m_host->GetShadowNodeForTag(childTag);
+    if (childNode.m_layoutOnly)
+      MarkFlattenedChildrenHaveNewLayout(childNode);
+  }
+}
+
+void NativeUIManager::SetViewFlatteningEnabled(bool enabled) {
+  m_viewFlatteningEnabled = enabled;
+}
+
 void NativeUIManager::CreateView(facebook::react::ShadowNode &shadowNode, folly::dynamic /*ReadableMap*/ props) {
   ShadowNodeBase &node = static_cast<ShadowNodeBase &>(shadowNode);
   auto *pViewManager = node.GetViewManager();
@@ -833,6 +931,9 @@ void NativeUIManager::UpdateExtraLayout(int64_t tag) {
 }
 
 void NativeUIManager::DoLayout() {
+  // Any layout pass satisfies a pending frame-coalesced one.
+  m_rendering.revoke();
+
   // Process vector of RN controls needing extra layout here.
   const auto extraLayoutNodes = m_extraLayoutNodes;
   for (const int64_t tag : extraLayoutNodes) {
@@ -842,6 +943,7 @@ void NativeUIManager::DoLayout() {
   }
   // Values need to be cleared from the vector before next call to DoLayout.
   m_extraLayoutNodes.clear();
+
   auto &rootTags = m_host->GetAllRootTags();
   for (int64_t rootTag : rootTags) {
     UpdateExtraLayout(rootTag);
@@ -855,26 +957,158 @@ void NativeUIManager::DoLayout() {
 
     // TODO: Real direction (VSO 1697992: RTL Layout)
     YGNodeCalculateLayout(rootNode, actualWidth, actualHeight, YGDirectionLTR);
+  }
 
+  // A moved layout-only node moves the views flattened into its ancestor, even
+  // when their own Yoga layout did not change.
+  if (m_viewFlatteningEnabled) {
     for (auto &tagToYogaNode : m_tagsToYogaNodes) {
-      int64_t tag = tagToYogaNode.first;
-      YGNodeRef yogaNode = tagToYogaNode.second.get();
-
-      if (!YGNodeGetHasNewLayout(yogaNode))
-        continue;
-      YGNodeSetHasNewLayout(yogaNode, false);
-
-      float left = YGNodeLayoutGetLeft(yogaNode);
-      float top = YGNodeLayoutGetTop(yogaNode);
-      float width = YGNodeLayoutGetWidth(yogaNode);
-      float height = YGNodeLayoutGetHeight(yogaNode);
-
-      ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
-      auto view = shadowNode.GetView();
-      auto pViewManager = shadowNode.GetViewManager();
-      pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+      if (YGNodeGetHasNewLayout(tagToYogaNode.second.get())) {
+        auto &shadowNode = m_host->GetShadowNodeForTag(tagToYogaNode.first);
+        if (shadowNode.m_layoutOnly)
+          MarkFlattenedChildrenHaveNewLayout(shadowNode);
+      }
+    }
+  }
+
+  // Apply the new frames of all roots in one pass.
+  for (auto &tagToYogaNode : m_tagsToYogaNodes) {
+    int64_t tag = tagToYogaNode.first;
+    YGNodeRef yogaNode = tagToYogaNode.second.get();
+
+    if (!YGNodeGetHasNewLayout(yogaNode))
+      continue;
+    YGNodeSetHasNewLayout(yogaNode, false);
+
+    ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
+    if (shadowNode.m_layoutOnly)
+      continue;
+
+    float left = YGNodeLayoutGetLeft(yogaNode);
+    float top = YGNodeLayoutGetTop(yogaNode);
+    float width = YGNodeLayoutGetWidth(yogaNode);
+    float height = YGNodeLayoutGetHeight(yogaNode);
+
+    // Layout-only ancestors have no view; fold their offsets into this one.
+    for (int64_t parentTag = shadowNode.m_parent; parentTag != -1;) {
+      auto &parentNode = m_host->GetShadowNodeForTag(parentTag);
+      if (!parentNode.m_layoutOnly)
+        break;
+
+      YGNodeRef parentYogaNode = GetYogaNode(parentTag);
+      left += YGNodeLayoutGetLeft(parentYogaNode);
+      top += YGNodeLayoutGetTop(parentYogaNode);
+      parentTag = parentNode.m_parent;
     }
+
+    auto view = shadowNode.GetView();
+    auto pViewManager = shadowNode.GetViewManager();
+    pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+  }
+
+  if (m_hitTestIndexEnabled)
+    UpdateHitTestIndex();
+}
+
+void NativeUIManager::UpdateHitTestIndex() {
+  for (int64_t rootTag : m_host->GetAllRootTags()) {
+    YGNodeRef rootYogaNode = GetYogaNode(rootTag);
+    if (rootYogaNode == nullptr)
+      continue;
+
+    m_hitTestIndex.BeginRoot(rootTag, YGNodeLayoutGetWidth(rootYogaNode), YGNodeLayoutGetHeight(rootYogaNode));
+    AddToHitTestIndex(m_host->GetShadowNodeForTag(rootTag), -1);
+    m_hitTestIndex.EndRoot();
+  }
+}
+
+static int32_t ZIndexOf(ShadowNodeBase &node) {
+  auto element = node.GetView().try_as<winrt::UIElement>();
+  return element ? winrt::Canvas::GetZIndex(element) : 0;
+}
+
+void NativeUIManager::AddToHitTestIndex(facebook::react::ShadowNode &shadowNode, int64_t parentTag) {
+  ShadowNodeBase &node = static_cast<ShadowNodeBase &>(shadowNode);
+  YGNodeRef yogaNode = GetYogaNode(node.m_tag);
+
+  // Popups and flyouts render outside of their parent and have their own
+  // touch handling.
+  if (yogaNode == nullptr || node.IsWindowed())
+    return;
+
+  facebook::react::HitTestNode hitTestNode;
+  hitTestNode.tag = node.m_tag;
+  hitTestNode.parentTag = parentTag;
+  if (parentTag != -1) {
+    hitTestNode.left = YGNodeLayoutGetLeft(yogaNode);
+    hitTestNode.top = YGNodeLayoutGetTop(yogaNode);
   }
+  hitTestNode.width = YGNodeLayoutGetWidth(yogaNode);
+  hitTestNode.height = YGNodeLayoutGetHeight(yogaNode);
+
+  if (node.m_layoutOnly) {
+    // There is no view to target, only its children
+    hitTestNode.pointerEvents = facebook::react::PointerEvents::BoxNone;
+  } else {
+    auto element = node.GetView().try_as<winrt::UIElement>();
+    if (element == nullptr || element.Visibility() == winrt::Visibility::Collapsed)
+      return;
+
+    hitTestNode.pointerEvents =
+        element.IsHitTestVisible() ? node.m_pointerEvents : facebook::react::PointerEvents::None;
+    hitTestNode.contentOutsideLayout = element.try_as<winrt::ScrollViewer>() != nullptr;
+
+    // Mirrors the centering expression that drives UIElement.TransformMatrix
+    winrt::Windows::Foundation::Numerics::float4x4 matrix;
+    if (node.HasTransformPS() &&
+        node.EnsureTransformPS().TryGetMatrix4x4(L"transform", matrix) ==
+            winrt::Windows::UI::Composition::CompositionGetValueStatus::Succeeded) {
+      float centerX = hitTestNode.width / 2;
+      float centerY = hitTestNode.height / 2;
+      hitTestNode.transform = facebook::react::HitTestTransform::Translation(-centerX, -centerY)
+                                  .Then({matrix.m11, matrix.m12, matrix.m21, matrix.m22, matrix.m41, matrix.m42})
+                                  .Then(facebook::react::HitTestTransform::Translation(centerX, centerY));
+    }
+  }
+
+  m_hitTestIndex.AddNode(hitTestNode);
+
+  // Children of self-measuring controls are not laid out by Yoga.
+  if (node.GetViewManager()->IsNativeControlWithSelfLayout())
+    return;
+
+  // Siblings paint in z-index order, then in child order.
+  bool hasZIndex = false;
+  for (int64_t childTag : node.m_children) {
+    if (ZIndexOf(static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(childTag))) != 0) {
+      hasZIndex = true;
+      break;
+    }
+  }
+
+  if (!hasZIndex) {
+    for (int64_t childTag : node.m_children)
+      AddToHitTestIndex(m_host->GetShadowNodeForTag(childTag), node.m_tag);
+    return;
+  }
+
+  std::vector<std::pair<int32_t, int64_t>> children;
+  for (int64_t childTag : node.m_children)
+    children.emplace_back(ZIndexOf(static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(childTag))), childTag);
+  std::stable_sort(
+      children.begin(), children.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+  for (const auto &child : children)
+    AddToHitTestIndex(m_host->GetShadowNodeForTag(child.second), node.m_tag);
+}
+
+void NativeUIManager::SetHitTestIndexEnabled(bool enabled) {
+  m_hitTestIndexEnabled = enabled;
+  if (!enabled)
+    m_hitTestIndex.Clear();
+}
+
+const facebook::react::HitTestIndex *NativeUIManager::GetHitTestIndex() const noexcept {
+  return m_hitTestIndexEnabled ? &m_hitTestIndex : nullptr;
 }
 
 winrt::Windows::Foundation::Rect GetRectOfElementInParentCoords(
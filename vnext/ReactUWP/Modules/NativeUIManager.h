@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <HitTestIndex.h>
 #include <INativeUIManager.h>
 #include <IReactRootView.h>
 #include <Views/ViewManagerBase.h>
 
+#include <winrt/Windows.UI.Xaml.Media.h>
 #include <winrt/Windows.UI.Xaml.h>
 
 #include <folly/dynamic.h>
@@ -77,10 +79,29 @@ class NativeUIManager : public facebook::react::INativeUIManager {
   void focus(int64_t reactTag) override;
   void blur(int64_t reactTag) override;
 
+  bool isLayoutOnlyView(const std::string &className, const folly::dynamic &props) override;
+  bool canHostLayoutOnlyChildren(facebook::react::ShadowNode &nativeParent) override;
+  void OnLayoutOnlyViewPromoted(facebook::react::ShadowNode &shadowNode) override;
+
   // Other public functions
   void DirtyYogaNode(int64_t tag);
   void AddBatchCompletedCallback(std::function<void()> callback);
 
+  // Number of root SizeChanged layout passes that were folded into an already
+  // scheduled per-frame layout.
+  uint64_t GetSkippedLayoutPassCount() const noexcept;
+
+  // When enabled, Views that only carry layout props are kept as Yoga-only
+  // nodes and their children are mounted into the nearest real ancestor.
+  void SetViewFlatteningEnabled(bool enabled);
+
+  // When enabled, each layout pass also indexes the laid out frames so that
+  // pointer targets can be resolved without walking the XAML tree.
+  void SetHitTestIndexEnabled(bool enabled);
+
+  // Returns nullptr when the hit-test index is not enabled.
+  const facebook::react::HitTestIndex *GetHitTestIndex() const noexcept;
+
   // For unparented node like Flyout, XamlRoot should be set to handle
   // XamlIsland/AppWindow scenarios. Since it doesn't have parent, and all nodes
   // in the tree should have the same XamlRoot, this function iterates all roots
@@ -93,7 +114,11 @@ class NativeUIManager : public facebook::react::INativeUIManager {
 
  private:
   void DoLayout();
+  void ScheduleLayoutForNextFrame();
   void UpdateExtraLayout(int64_t tag);
+  void MarkFlattenedChildrenHaveNewLayout(facebook::react::ShadowNode &shadowNode);
+  void UpdateHitTestIndex();
+  void AddToHitTestIndex(facebook::react::ShadowNode &shadowNode, int64_t parentTag);
   YGNodeRef GetYogaNode(int64_t tag) const;
 
   std::weak_ptr<react::uwp::IXamlReactControl> GetParentXamlReactControl(int64_t tag) const;
@@ -101,12 +126,17 @@ class NativeUIManager : public facebook::react::INativeUIManager {
  private:
   facebook::react::INativeUIManagerHost *m_host = nullptr;
   bool m_inBatch = false;
+  bool m_viewFlatteningEnabled = false;
+  bool m_hitTestIndexEnabled = false;
 
   std::map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
   std::map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
   std::vector<winrt::Windows::UI::Xaml::FrameworkElement::SizeChanged_revoker> m_sizeChangedVector;
+  winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
+  uint64_t m_skippedLayoutPassCount = 0;
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
   std::vector<int64_t> m_extraLayoutNodes;
+  facebook::react::HitTestIndex m_hitTestIndex;
 
   std::map<int64_t, std::weak_ptr<IXamlReactControl>> m_tagsToXamlReactControl;
 };
@@ -31,48 +31,12 @@ using namespace std;
 namespace react {
 namespace uwp {
 
-//
-// TimerQueue
-//
-
-TimerQueue::TimerQueue() {
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-  m_timerVector.emplace_back(id, targetTime, period, repeat);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-void TimerQueue::Remove(int64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end())
-    m_timerVector.erase(found);
-
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-bool TimerQueue::IsEmpty() {
-  return m_timerVector.empty();
-}
-
 //
 // Timing
 //
 
-Timing::Timing(TimingModule *parent) : m_parent(parent) {}
+Timing::Timing(TimingModule *parent, double timerSlackMs, std::shared_ptr<facebook::react::TimerStats> stats)
+    : m_parent(parent), m_slack(TimeSpanFromMs(std::max(timerSlackMs, 0.0))), m_stats(std::move(stats)) {}
 
 void Timing::Disconnect() {
   m_parent = nullptr;
@@ -86,22 +50,19 @@ std::weak_ptr<facebook::react::Instance> Timing::getInstance() noexcept {
 }
 
 void Timing::OnRendering(const winrt::IInspectable &, const winrt::IInspectable & /*args*/) {
+  m_idleCallbacks.BeginFrame(std::chrono::steady_clock::now());
+
   std::vector<int64_t> readyTimers;
   auto now = winrt::DateTime::clock::now();
 
-  while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < now) {
-    // Pop first timer from the queue and add it to list of timers ready to fire
-    Timer next = m_timerQueue.Front();
-    m_timerQueue.Pop();
-    readyTimers.push_back(next.Id);
-
-    // If timer is repeating push it back onto the queue for the next repetition
-    if (next.Repeat)
-      m_timerQueue.Push(next.Id, now + next.Period, next.Period, true);
-
-    if (m_timerQueue.IsEmpty())
-      m_rendering.revoke();
+  // Nothing fires until some timer runs out of slack; then every timer that
+  // is due goes out with it in one batch.
+  if (!m_timerQueue.IsEmpty() && m_timerQueue.NextDeadline() <= now) {
+    readyTimers = m_timerQueue.PopExpired(now, now);
+    if (m_stats)
+      m_stats->Publish(m_timerQueue.GetStats());
   }
+  UpdateRendering();
 
   if (!readyTimers.empty()) {
     if (auto instance = getInstance().lock()) {
@@ -116,6 +77,30 @@ void Timing::OnRendering(const winrt::IInspectable &, const winrt::IInspectable
       assert(false && "getInstance().lock failed");
     }
   }
+
+  // Idle callbacks get what is left of the frame once the timers ran.
+  if (m_idleCallbacks.EndFrameWork(std::chrono::steady_clock::now()))
+    SendIdleEvents();
+}
+
+void Timing::UpdateRendering() {
+  // Frames are only observed while there is something to do in them.
+  if (m_timerQueue.IsEmpty() && !m_idleCallbacks.IsEnabled()) {
+    m_rendering.revoke();
+  } else if (!m_rendering) {
+    m_rendering =
+        winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering(winrt::auto_revoke, {this, &Timing::OnRendering});
+  }
+}
+
+void Timing::SendIdleEvents() {
+  if (auto instance = getInstance().lock()) {
+    // JSTimers measures the frame from its start, on the Date.now() clock.
+    const auto frameAge = std::chrono::steady_clock::now() - m_idleCallbacks.FrameStart();
+    const auto frameStart = std::chrono::system_clock::now() - frameAge;
+    const double frameStartMs = std::chrono::duration<double, std::milli>(frameStart.time_since_epoch()).count();
+    instance->callJSFunction("JSTimers", "callIdleCallbacks", folly::dynamic::array(frameStartMs));
+  }
 }
 
 void Timing::createTimer(int64_t id, double duration, double jsSchedulingTime, bool repeat) {
@@ -130,12 +115,6 @@ void Timing::createTimer(int64_t id, double duration, double jsSchedulingTime, b
     return;
   }
 
-  if (m_timerQueue.IsEmpty()) {
-    m_rendering.revoke();
-    m_rendering =
-        winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering(winrt::auto_revoke, {this, &Timing::OnRendering});
-  }
-
   // Convert double duration in ms to TimeSpan
   // Make sure duration is always larger than 16ms to avoid unnecessary wakeups.
   auto period = TimeSpanFromMs(std::max(duration, 16.0));
@@ -143,18 +122,18 @@ void Timing::createTimer(int64_t id, double duration, double jsSchedulingTime, b
   winrt::DateTime scheduledTime(TimeSpanFromMs(jsSchedulingTime + msFrom1601to1970));
   auto initialTargetTime = scheduledTime + period;
 
-  m_timerQueue.Push(id, initialTargetTime, period, repeat);
+  m_timerQueue.Push(Timer{id, initialTargetTime, period, repeat, m_slack});
+  UpdateRendering();
 }
 
 void Timing::deleteTimer(int64_t id) {
   m_timerQueue.Remove(id);
-
-  if (m_timerQueue.IsEmpty())
-    m_rendering.revoke();
+  UpdateRendering();
 }
 
-void Timing::setSendIdleEvents(bool /*sendIdleEvents*/) {
-  // TODO: Implement.
+void Timing::setSendIdleEvents(bool sendIdleEvents) {
+  m_idleCallbacks.SetEnabled(sendIdleEvents);
+  UpdateRendering();
 }
 
 //
@@ -162,7 +141,8 @@ void Timing::setSendIdleEvents(bool /*sendIdleEvents*/) {
 //
 const char *TimingModule::name = "Timing";
 
-TimingModule::TimingModule() : m_timing(std::make_shared<Timing>(this)) {}
+TimingModule::TimingModule(double timerSlackMs, std::shared_ptr<facebook::react::TimerStats> stats)
+    : m_timing(std::make_shared<Timing>(this, timerSlackMs, std::move(stats))) {}
 
 TimingModule::~TimingModule() {
   if (m_timing != nullptr)
@@ -211,5 +191,12 @@ std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
   return std::make_unique<::react::uwp::TimingModule>();
 }
 
+std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
+    const std::shared_ptr<facebook::react::MessageQueueThread> &,
+    double timerSlackMs,
+    std::shared_ptr<TimerStats> stats) noexcept {
+  return std::make_unique<::react::uwp::TimingModule>(timerSlackMs, std::move(stats));
+}
+
 } // namespace react
 } // namespace facebook
@@ -6,6 +6,8 @@
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
 
+#include <IdleCallbackScheduler.h>
+#include <TimerHeap.h>
 #include <folly/dynamic.h>
 #include <memory>
 #include <vector>
@@ -21,46 +23,13 @@ typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
 
 class TimingModule;
 
-struct Timer {
-  Timer(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-    Id = id;
-    TargetTime = targetTime;
-    Period = period;
-    Repeat = repeat;
-  }
-
-  bool operator<(const Timer &timer) const {
-    return timer.TargetTime < TargetTime;
-  }
-
-  bool operator==(int64_t id) const {
-    return id == Id;
-  }
-
-  int64_t Id;
-  TDateTime TargetTime;
-  TTimeSpan Period;
-  bool Repeat;
-};
-
-class TimerQueue {
- public:
-  TimerQueue();
-
-  void Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
-  void Pop();
-  Timer &Front();
-  void Remove(int64_t id);
-
-  bool IsEmpty();
-
- private:
-  std::vector<Timer> m_timerVector;
-};
+using TimerQueue = facebook::react::TimerHeap<TDateTime>;
+using Timer = TimerQueue::Timer;
 
+// Every timer may fire up to timerSlackMs late, together with other timers.
 class Timing {
  public:
-  Timing(TimingModule *parent);
+  Timing(TimingModule *parent, double timerSlackMs, std::shared_ptr<facebook::react::TimerStats> stats);
   void Disconnect();
 
   void createTimer(int64_t id, double duration, double jsSchedulingTime, bool repeat);
@@ -72,16 +41,21 @@ class Timing {
   void OnRendering(
       const winrt::Windows::Foundation::IInspectable &,
       const winrt::Windows::Foundation::IInspectable &args);
+  void UpdateRendering();
+  void SendIdleEvents();
 
  private:
   TimingModule *m_parent;
   TimerQueue m_timerQueue;
+  TTimeSpan m_slack;
+  std::shared_ptr<facebook::react::TimerStats> m_stats;
+  facebook::react::IdleCallbackScheduler m_idleCallbacks;
   winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
 };
 
 class TimingModule : public facebook::xplat::module::CxxModule {
  public:
-  TimingModule();
+  TimingModule(double timerSlackMs = 0, std::shared_ptr<facebook::react::TimerStats> stats = nullptr);
   ~TimingModule();
   std::string getName();
   virtual auto getConstants() -> std::map<std::string, folly::dynamic>;
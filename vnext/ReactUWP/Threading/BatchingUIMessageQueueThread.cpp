@@ -17,8 +17,7 @@ BatchingUIMessageQueueThread::~BatchingUIMessageQueueThread() {}
 
 void BatchingUIMessageQueueThread::runOnQueue(std::function<void()> &&func) {
   threadCheck();
-  ensureQueue();
-  m_queue->emplace_back(std::move(func));
+  m_queues.Current().Push(facebook::react::TaskPriority::Normal, std::move(func));
 
 //#define TRACK_UI_CALLS
 #ifdef TRACK_UI_CALLS
@@ -39,21 +38,12 @@ void BatchingUIMessageQueueThread::threadCheck() {
 #endif
 }
 
-void BatchingUIMessageQueueThread::ensureQueue() {
-  if (m_queue == nullptr) {
-    m_queue = std::make_unique<WorkItemQueue>();
-    m_queue->reserve(2048);
-  }
-}
-
 void BatchingUIMessageQueueThread::onBatchComplete() {
   threadCheck();
-  std::shared_ptr<WorkItemQueue> queue = m_queue;
-  m_queue = nullptr;
-  if (queue) {
+  if (std::shared_ptr<WorkItemQueue> queue = m_queues.TakeBatch()) {
     m_uiDispatcher.RunAsync(winrt::Windows::UI::Core::CoreDispatcherPriority::Normal, [queue{std::move(queue)}]() {
-      for (auto &func : *queue) {
-        func();
+      while (!queue->IsEmpty()) {
+        queue->Pop()();
       }
     });
   }
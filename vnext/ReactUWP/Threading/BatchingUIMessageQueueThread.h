@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <ReactWindowsCore/BatchBuffers.h>
 #include <ReactWindowsCore/BatchingMessageQueueThread.h>
+#include <ReactWindowsCore/PriorityMessageQueue.h>
 #include <winrt/Windows.UI.Core.h>
 
 namespace react {
@@ -25,14 +27,16 @@ class BatchingUIMessageQueueThread : public facebook::react::BatchingMessageQueu
   void onBatchComplete() override;
 
  private:
-  void ensureQueue();
   void threadCheck();
 
  private:
   winrt::Windows::UI::Core::CoreDispatcher m_uiDispatcher{nullptr};
 
-  typedef std::vector<std::function<void()>> WorkItemQueue;
-  std::shared_ptr<WorkItemQueue> m_queue;
+  // The batches alternate between two recycled queues, so a steady stream of
+  // batches does not allocate.
+  typedef facebook::react::TaskLanes<std::function<void()>, facebook::react::RecycledLane<std::function<void()>>>
+      WorkItemQueue;
+  facebook::react::BatchBuffers<WorkItemQueue> m_queues;
 
 #if DEBUG
   DWORD m_expectedThreadId = 0;
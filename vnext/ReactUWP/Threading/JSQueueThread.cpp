@@ -40,8 +40,9 @@ static void SetThreadName(std::thread &thread, const char *threadName) {
   SetThreadName(threadId, threadName);
 }
 
-std::shared_ptr<facebook::react::MessageQueueThread> CreateAndStartJSQueueThread() {
-  auto q = std::make_shared<facebook::react::CxxMessageQueue>();
+std::shared_ptr<facebook::react::MessageQueueThread> CreateAndStartJSQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> stats) {
+  auto q = std::make_shared<facebook::react::CxxMessageQueue>(std::move(stats));
   std::thread t([q]() mutable {
     auto loop = facebook::react::CxxMessageQueue::getRunLoop(q);
     // Note: make sure that no stack frames above loop() have a strong reference
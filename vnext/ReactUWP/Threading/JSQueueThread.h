@@ -8,12 +8,14 @@
 namespace facebook {
 namespace react {
 class MessageQueueThread;
+class QueueStats;
 }
 } // namespace facebook
 
 namespace react {
 namespace uwp {
 
-std::shared_ptr<facebook::react::MessageQueueThread> CreateAndStartJSQueueThread();
+std::shared_ptr<facebook::react::MessageQueueThread> CreateAndStartJSQueueThread(
+    std::shared_ptr<facebook::react::QueueStats> stats = nullptr);
 }
 } // namespace react
@@ -10,13 +10,31 @@
 namespace react {
 namespace uwp {
 
-UIMessageQueueThread::UIMessageQueueThread(winrt::Windows::UI::Core::CoreDispatcher dispatcher)
-    : m_uiDispatcher(dispatcher) {}
+UIMessageQueueThread::UIMessageQueueThread(
+    winrt::Windows::UI::Core::CoreDispatcher dispatcher,
+    std::shared_ptr<facebook::react::QueueStats> stats)
+    : m_uiDispatcher(dispatcher), m_stats(std::move(stats)) {}
 
 UIMessageQueueThread::~UIMessageQueueThread() {}
 
 void UIMessageQueueThread::runOnQueue(std::function<void()> &&func) {
-  m_uiDispatcher.RunAsync(winrt::Windows::UI::Core::CoreDispatcherPriority::Normal, [func = std::move(func)]() {
+  runOnQueueWithPriority(facebook::react::TaskPriority::Normal, std::move(func));
+}
+
+void UIMessageQueueThread::runOnQueueWithPriority(
+    facebook::react::TaskPriority priority,
+    std::function<void()> &&func) {
+  // High is reserved for the system: work posted there runs ahead of input
+  // and rendering. So UserBlocking stays at Normal, and only Background work
+  // steps aside, to Low, which runs once no Normal work is pending.
+  auto dispatcherPriority = winrt::Windows::UI::Core::CoreDispatcherPriority::Normal;
+  if (priority == facebook::react::TaskPriority::Background)
+    dispatcherPriority = winrt::Windows::UI::Core::CoreDispatcherPriority::Low;
+
+  if (m_stats)
+    func = facebook::react::MakeMeasuredTask(m_stats, std::move(func));
+
+  m_uiDispatcher.RunAsync(dispatcherPriority, [func = std::move(func)]() {
 
 //#define TRACK_UI_CALLS
 #ifdef TRACK_UI_CALLS
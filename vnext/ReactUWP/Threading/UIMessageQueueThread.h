@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <PriorityMessageQueue.h>
+#include <QueueStats.h>
 #include <cxxreact/MessageQueueThread.h>
 #include <winrt/Windows.UI.Core.h>
 
@@ -10,20 +12,24 @@ namespace react {
 namespace uwp {
 
 // Executes the function on the provided UI Dispatcher
-class UIMessageQueueThread : public facebook::react::MessageQueueThread {
+class UIMessageQueueThread : public facebook::react::MessageQueueThread, public facebook::react::IPriorityMessageQueue {
  public:
   UIMessageQueueThread() = delete;
   UIMessageQueueThread(const UIMessageQueueThread &other) = delete;
 
-  UIMessageQueueThread(winrt::Windows::UI::Core::CoreDispatcher dispatcher);
+  UIMessageQueueThread(
+      winrt::Windows::UI::Core::CoreDispatcher dispatcher,
+      std::shared_ptr<facebook::react::QueueStats> stats = nullptr);
   virtual ~UIMessageQueueThread();
 
   virtual void runOnQueue(std::function<void()> &&func);
+  virtual void runOnQueueWithPriority(facebook::react::TaskPriority priority, std::function<void()> &&func);
   virtual void runOnQueueSync(std::function<void()> &&func);
   virtual void quitSynchronous();
 
  private:
   winrt::Windows::UI::Core::CoreDispatcher m_uiDispatcher{nullptr};
+  const std::shared_ptr<facebook::react::QueueStats> m_stats;
 };
 
 } // namespace uwp
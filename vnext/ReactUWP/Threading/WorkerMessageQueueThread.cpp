@@ -7,6 +7,7 @@
 
 #include <wrl.h>
 #include <atomic>
+#include <mutex>
 #include "AsyncWorkQueue.h"
 
 namespace react {
@@ -79,12 +80,18 @@ COM_DECLSPEC_NOTHROW STDMETHODIMP AsyncCallback::CancelWorkItem(_In_opt_ IUnknow
 struct WorkerMessageQueueThread::Impl {
   Impl();
   ~Impl();
-  void runOnQueue(std::function<void()> &&func);
+  void runOnQueue(std::function<void()> &&func, facebook::react::TaskPriority priority);
   void runOnQueueSync(std::function<void()> &&func);
   void quitSynchronous();
+  void runNext();
 
   Microsoft::WRL::ComPtr<IAsyncWorkQueue> queue;
   std::atomic_bool stopped{false};
+
+  // Each work item runs whichever task is next by priority, not the task it
+  // was queued for. The queue is serial, so tasks still run one at a time.
+  std::mutex lanesMutex;
+  facebook::react::TaskLanes<std::function<void()>> lanes;
 };
 
 WorkerMessageQueueThread::Impl::Impl() {
@@ -99,20 +106,34 @@ WorkerMessageQueueThread::Impl::~Impl() {
   }
 }
 
-void WorkerMessageQueueThread::Impl::runOnQueue(std::function<void()> &&func) {
+void WorkerMessageQueueThread::Impl::runOnQueue(
+    std::function<void()> &&func,
+    facebook::react::TaskPriority priority) {
   // TODO: Asserts
   // Assert(!stopped)
 
-  Microsoft::WRL::ComPtr<AsyncCallback> callback(new AsyncCallback(std::move(func)));
+  {
+    std::lock_guard<std::mutex> lock(lanesMutex);
+    lanes.Push(priority, std::move(func));
+  }
+
+  Microsoft::WRL::ComPtr<AsyncCallback> callback(new AsyncCallback([this]() { runNext(); }));
   queue->QueueWorkItem(callback.Get(), nullptr /*pUserData*/);
 }
 
-void WorkerMessageQueueThread::Impl::runOnQueueSync(std::function<void()> &&func) {
-  // TODO: Asserts
-  // Assert(!stopped)
+void WorkerMessageQueueThread::Impl::runNext() {
+  std::function<void()> func;
+  {
+    std::lock_guard<std::mutex> lock(lanesMutex);
+    if (lanes.IsEmpty())
+      return;
+    func = lanes.Pop();
+  }
+  func();
+}
 
-  Microsoft::WRL::ComPtr<AsyncCallback> callback(new AsyncCallback(std::move(func)));
-  queue->QueueWorkItem(callback.Get(), nullptr /*pUserData*/);
+void WorkerMessageQueueThread::Impl::runOnQueueSync(std::function<void()> &&func) {
+  runOnQueue(std::move(func), facebook::react::TaskPriority::Normal);
   queue->WaitForCallbacksToComplete();
 }
 
@@ -130,7 +151,13 @@ WorkerMessageQueueThread::WorkerMessageQueueThread() {
 WorkerMessageQueueThread::~WorkerMessageQueueThread() {}
 
 void WorkerMessageQueueThread::runOnQueue(std::function<void()> &&func) {
-  m_pimpl->runOnQueue(std::move(func));
+  m_pimpl->runOnQueue(std::move(func), facebook::react::TaskPriority::Normal);
+}
+
+void WorkerMessageQueueThread::runOnQueueWithPriority(
+    facebook::react::TaskPriority priority,
+    std::function<void()> &&func) {
+  m_pimpl->runOnQueue(std::move(func), priority);
 }
 
 void WorkerMessageQueueThread::runOnQueueSync(std::function<void()> &&func) {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <PriorityMessageQueue.h>
 #include <cxxreact/MessageQueueThread.h>
 
 namespace react {
@@ -12,12 +13,14 @@ namespace uwp {
 // Serial execution is guaranteed.
 // Must be destroyed from a UI or JavaScript thread. Destroying from a
 // background thread can cause deadlocks! Same applies for quitSynchronous().
-class WorkerMessageQueueThread : public facebook::react::MessageQueueThread {
+class WorkerMessageQueueThread : public facebook::react::MessageQueueThread,
+                                 public facebook::react::IPriorityMessageQueue {
  public:
   WorkerMessageQueueThread();
   virtual ~WorkerMessageQueueThread();
 
   virtual void runOnQueue(std::function<void()> &&func);
+  virtual void runOnQueueWithPriority(facebook::react::TaskPriority priority, std::function<void()> &&func);
   virtual void runOnQueueSync(std::function<void()> &&func);
   virtual void quitSynchronous();
 
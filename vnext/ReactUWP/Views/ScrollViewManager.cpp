@@ -3,6 +3,7 @@
 
 #include "pch.h"
 
+#include <Modules/Animated/NativeAnimatedNodeManager.h>
 #include <ReactUWP\Views\SIPEventHandler.h>
 #include <Views/ShadowNodeBase.h>
 #include "Impl/ScrollViewUWPImplementation.h"
@@ -321,6 +322,25 @@ void ScrollViewShadowNode::EmitScrollEvent(
 
   const auto scrollViewerNotNull = scrollViewer;
 
+  // Values bound with Animated.event track the scroll in this frame; JS still
+  // gets the event for its own listeners.
+  if (const auto animatedNodeManager = instance->GetNativeAnimatedNodeManager()) {
+    facebook::react::NativeAnimatedEvent event;
+    event.Set(facebook::react::NativeEventField::ContentOffsetX, x);
+    event.Set(facebook::react::NativeEventField::ContentOffsetY, y);
+    event.Set(facebook::react::NativeEventField::ContentInsetLeft, 0);
+    event.Set(facebook::react::NativeEventField::ContentInsetTop, 0);
+    event.Set(facebook::react::NativeEventField::ContentInsetRight, 0);
+    event.Set(facebook::react::NativeEventField::ContentInsetBottom, 0);
+    event.Set(facebook::react::NativeEventField::ContentSizeWidth, scrollViewerNotNull.ExtentWidth());
+    event.Set(facebook::react::NativeEventField::ContentSizeHeight, scrollViewerNotNull.ExtentHeight());
+    event.Set(facebook::react::NativeEventField::LayoutMeasurementWidth, scrollViewerNotNull.ActualWidth());
+    event.Set(facebook::react::NativeEventField::LayoutMeasurementHeight, scrollViewerNotNull.ActualHeight());
+    event.Set(facebook::react::NativeEventField::ZoomScale, zoom);
+
+    animatedNodeManager->DispatchNativeEvent(tag, eventName, event);
+  }
+
   folly::dynamic offset = folly::dynamic::object("x", x)("y", y);
 
   folly::dynamic contentInset = folly::dynamic::object("left", 0)("top", 0)("right", 0)("bottom", 0);
@@ -6,6 +6,7 @@
 #include <Views/ShadowNodeBase.h>
 #include "TouchEventHandler.h"
 
+#include <Modules/Animated/NativeAnimatedNodeManager.h>
 #include <Modules/NativeUIManager.h>
 #include <Utils/ValueUtils.h>
 
@@ -132,8 +133,10 @@ void TouchEventHandler::OnPointerMoved(
   } else {
     // Move with no buttons pressed
     UpdatePointersInViews(args, tag, sourceElement);
-    // MouseMove support: (Not yet enabled, requires adding to ViewPropTypes.js)
-    // SendPointerMove(args, tag, sourceElement);
+    // Hover moves are frequent; they are only raised to views that registered
+    // onMouseMove, and only when event coalescing merges them before JS.
+    if (instance->GetReactInstanceSettings().EnableEventCoalescing)
+      SendPointerMove(args, tag, sourceElement);
   }
 }
 
@@ -305,8 +308,16 @@ void TouchEventHandler::SendPointerMove(
   if (m_pointers.size() == 0) // If we created a reactPointer, reset the touchId back to zero
     m_touchId = 0;
 
-  folly::dynamic touch = GetPointerJson(pointer, pointer.target);
-  instance->DispatchEvent(tag, "topMouseEnter", GetPointerJson(pointer, tag));
+  if (const auto animatedNodeManager = instance->GetNativeAnimatedNodeManager()) {
+    facebook::react::NativeAnimatedEvent event;
+    event.Set(facebook::react::NativeEventField::PageX, pointer.positionRoot.X);
+    event.Set(facebook::react::NativeEventField::PageY, pointer.positionRoot.Y);
+    event.Set(facebook::react::NativeEventField::LocationX, pointer.positionView.X);
+    event.Set(facebook::react::NativeEventField::LocationY, pointer.positionView.Y);
+    animatedNodeManager->DispatchNativeEvent(tag, "topMouseMove", event);
+  }
+
+  instance->DispatchEvent(tag, "topMouseMove", GetPointerJson(pointer, tag));
 }
 
 folly::dynamic TouchEventHandler::GetPointerJson(const ReactPointer &pointer, int64_t target) {
@@ -388,6 +399,28 @@ bool TouchEventHandler::TagFromOriginalSource(
     winrt::FrameworkElement *pSourceElement) {
   assert(pTag != nullptr);
 
+  int64_t rootTag;
+  if (auto index = GetHitTestIndex(&rootTag)) {
+    winrt::Point point = args.GetCurrentPoint(m_xamlView.as<winrt::UIElement>()).Position();
+    auto result = index->HitTest(rootTag, point.X, point.Y, m_hitTestChain);
+    if (result == facebook::react::HitTestIndex::Result::Miss)
+      return false;
+
+    if (result == facebook::react::HitTestIndex::Result::Hit) {
+      auto instance = m_wkReactInstance.lock();
+      auto nativeUiManager = static_cast<NativeUIManager *>(instance->NativeUIManager());
+      auto node =
+          static_cast<ShadowNodeBase *>(nativeUiManager->getHost()->FindShadowNodeForTag(m_hitTestChain.front()));
+      auto sourceElement = node ? node->GetView().try_as<winrt::FrameworkElement>() : nullptr;
+      if (sourceElement != nullptr) {
+        *pTag = node->m_tag;
+        *pSourceElement = sourceElement;
+        return true;
+      }
+    }
+    // Otherwise the index cannot tell, fall back to the XAML tree
+  }
+
   if (args.OriginalSource() == nullptr)
     return false;
 
@@ -422,6 +455,13 @@ std::set<int64_t> TouchEventHandler::GetTagsAtPoint(const winrt::PointerRoutedEv
   winrt::UIElement root(m_xamlView.as<winrt::UIElement>());
 
   winrt::Point point = e.GetCurrentPoint(root).Position();
+
+  int64_t rootTag;
+  if (auto index = GetHitTestIndex(&rootTag)) {
+    if (index->TagsAtPoint(rootTag, point.X, point.Y, tags) != facebook::react::HitTestIndex::Result::Unresolved)
+      return tags;
+  }
+
   auto transform = root.TransformToVisual(nullptr);
   point = transform.TransformPoint(point);
 
@@ -438,5 +478,24 @@ std::set<int64_t> TouchEventHandler::GetTagsAtPoint(const winrt::PointerRoutedEv
   return tags;
 }
 
+const facebook::react::HitTestIndex *TouchEventHandler::GetHitTestIndex(int64_t *pRootTag) {
+  auto instance = m_wkReactInstance.lock();
+  if (!instance)
+    return nullptr;
+
+  auto nativeUiManager = static_cast<NativeUIManager *>(instance->NativeUIManager());
+  const facebook::react::HitTestIndex *index = nativeUiManager->GetHitTestIndex();
+  if (index == nullptr)
+    return nullptr;
+
+  // Popups and flyouts attach handlers to views that are not roots
+  auto tag = GetTagAsPropertyValue(m_xamlView.as<winrt::FrameworkElement>());
+  if (tag == nullptr || !IsValidTag(tag) || !index->HasRoot(GetTag(tag)))
+    return nullptr;
+
+  *pRootTag = GetTag(tag);
+  return index;
+}
+
 } // namespace uwp
 } // namespace react
@@ -7,7 +7,9 @@
 #include <winrt/Windows.UI.Xaml.Input.h>
 #include <optional>
 #include <set>
+#include <vector>
 
+#include <HitTestIndex.h>
 #include <IReactInstance.h>
 #include "XamlView.h"
 
@@ -93,6 +95,11 @@ class TouchEventHandler {
       winrt::FrameworkElement *pSourceElement);
   std::set<int64_t> GetTagsAtPoint(const winrt::PointerRoutedEventArgs &e);
 
+  // The native hit-test index, when it is enabled and covers the root this
+  // handler is attached to.
+  const facebook::react::HitTestIndex *GetHitTestIndex(int64_t *pRootTag);
+  std::vector<int64_t> m_hitTestChain;
+
   XamlView m_xamlView;
   std::weak_ptr<IReactInstance> m_wkReactInstance;
 };
@@ -325,9 +325,8 @@ folly::dynamic ViewViewManager::GetNativeProps() const {
   auto props = Super::GetNativeProps();
 
   props.update(folly::dynamic::object("pointerEvents", "string")("onClick", "function")("onMouseEnter", "function")(
-      "onMouseLeave", "function")
-               //("onMouseMove", "function")
-               ("acceptsKeyboardFocus", "boolean")("enableFocusRing", "boolean")("tabIndex", "number"));
+      "onMouseLeave", "function")("onMouseMove", "function")("acceptsKeyboardFocus", "boolean")(
+      "enableFocusRing", "boolean")("tabIndex", "number"));
 
   return props;
 }
@@ -362,8 +361,18 @@ void ViewViewManager::UpdateProperties(ShadowNodeBase *nodeToUpdate, const folly
         }
       } else if (propertyName == "pointerEvents") {
         if (propertyValue.isString()) {
-          bool hitTestable = propertyValue.getString() != "none";
+          const std::string &pointerEvents = propertyValue.getString();
+          bool hitTestable = pointerEvents != "none";
           pPanel.IsHitTestVisible(hitTestable);
+
+          if (pointerEvents == "none")
+            pViewShadowNode->m_pointerEvents = facebook::react::PointerEvents::None;
+          else if (pointerEvents == "box-none")
+            pViewShadowNode->m_pointerEvents = facebook::react::PointerEvents::BoxNone;
+          else if (pointerEvents == "box-only")
+            pViewShadowNode->m_pointerEvents = facebook::react::PointerEvents::BoxOnly;
+          else
+            pViewShadowNode->m_pointerEvents = facebook::react::PointerEvents::Auto;
         }
       } else if (propertyName == "acceptsKeyboardFocus") {
         if (propertyValue.isBool())
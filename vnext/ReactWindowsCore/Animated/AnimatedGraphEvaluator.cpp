@@ -0,0 +1,408 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AnimatedGraphEvaluator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+double NumberOr(const folly::dynamic &config, const char *name, double defaultValue) {
+  auto value = config.get_ptr(name);
+  return value != nullptr && value->isNumber() ? value->asDouble() : defaultValue;
+}
+
+} // namespace
+
+bool AnimatedGraphEvaluator::CreateNode(int64_t tag, const folly::dynamic &config) {
+  if (m_tagToSlot.count(tag) > 0)
+    throw std::invalid_argument("AnimatedNode with tag " + std::to_string(tag) + " already exists.");
+
+  const std::string &type = config["type"].getString();
+  NodeKind kind;
+  if (type == "value")
+    kind = NodeKind::Value;
+  else if (type == "addition")
+    kind = NodeKind::Addition;
+  else if (type == "subtraction")
+    kind = NodeKind::Subtraction;
+  else if (type == "multiplication")
+    kind = NodeKind::Multiplication;
+  else if (type == "division")
+    kind = NodeKind::Division;
+  else if (type == "modulus")
+    kind = NodeKind::Modulus;
+  else if (type == "diffclamp")
+    kind = NodeKind::DiffClamp;
+  else if (type == "interpolation")
+    kind = NodeKind::Interpolation;
+  else
+    return false;
+
+  uint32_t slot;
+  if (!m_freeSlots.empty()) {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  } else {
+    slot = static_cast<uint32_t>(m_tags.size());
+    m_tags.emplace_back();
+    m_kinds.emplace_back();
+    m_rawValues.emplace_back();
+    m_offsets.emplace_back();
+    m_params0.emplace_back();
+    m_params1.emplace_back();
+    m_lastInputs.emplace_back();
+    m_dirty.emplace_back();
+    m_live.emplace_back();
+    m_inputTags.emplace_back();
+    m_interpolations.emplace_back();
+  }
+
+  m_tagToSlot[tag] = slot;
+  m_tags[slot] = tag;
+  m_kinds[slot] = kind;
+  m_rawValues[slot] = NumberOr(config, "value", 0.0);
+  m_offsets[slot] = NumberOr(config, "offset", 0.0);
+  m_params0[slot] = 0.0;
+  m_params1[slot] = 0.0;
+  m_lastInputs[slot] = std::numeric_limits<double>::quiet_NaN();
+  m_live[slot] = true;
+  m_inputTags[slot].clear();
+  m_interpolations[slot] = {};
+
+  if (auto inputs = config.get_ptr("input")) {
+    if (inputs->isArray()) {
+      for (const auto &input : *inputs)
+        m_inputTags[slot].push_back(static_cast<int64_t>(input.asDouble()));
+    } else {
+      m_inputTags[slot].push_back(static_cast<int64_t>(inputs->asDouble()));
+    }
+  }
+
+  switch (kind) {
+    case NodeKind::Modulus:
+      m_params0[slot] = NumberOr(config, "modulus", 1.0);
+      break;
+    case NodeKind::DiffClamp:
+      m_params0[slot] = NumberOr(config, "min", -std::numeric_limits<double>::infinity());
+      m_params1[slot] = NumberOr(config, "max", std::numeric_limits<double>::infinity());
+      break;
+    case NodeKind::Interpolation: {
+      auto &interpolation = m_interpolations[slot];
+      for (const auto &value : config["inputRange"])
+        interpolation.inputRange.push_back(value.asDouble());
+      for (const auto &value : config["outputRange"])
+        interpolation.outputRange.push_back(value.asDouble());
+      interpolation.extrapolateLeft = ExtrapolationFromString(config.getDefault("extrapolateLeft", "extend").asString());
+      interpolation.extrapolateRight =
+          ExtrapolationFromString(config.getDefault("extrapolateRight", "extend").asString());
+      break;
+    }
+    default:
+      break;
+  }
+
+  m_orderValid = false;
+  MarkDirty(slot);
+  return true;
+}
+
+void AnimatedGraphEvaluator::DropNode(int64_t tag) {
+  auto it = m_tagToSlot.find(tag);
+  if (it == m_tagToSlot.end())
+    return;
+
+  uint32_t slot = it->second;
+  m_live[slot] = false;
+  m_dirty[slot] = false;
+  m_inputTags[slot].clear();
+  m_interpolations[slot] = {};
+  m_freeSlots.push_back(slot);
+  m_tagToSlot.erase(it);
+  m_orderValid = false;
+}
+
+bool AnimatedGraphEvaluator::HasNode(int64_t tag) const {
+  return m_tagToSlot.count(tag) > 0;
+}
+
+void AnimatedGraphEvaluator::ConnectNodes(int64_t parentTag, int64_t childTag) {
+  auto it = m_tagToSlot.find(childTag);
+  if (it == m_tagToSlot.end() || m_kinds[it->second] != NodeKind::Interpolation)
+    return;
+
+  m_inputTags[it->second].assign(1, parentTag);
+  m_orderValid = false;
+  MarkDirty(it->second);
+}
+
+void AnimatedGraphEvaluator::DisconnectNodes(int64_t parentTag, int64_t childTag) {
+  auto it = m_tagToSlot.find(childTag);
+  if (it == m_tagToSlot.end() || m_kinds[it->second] != NodeKind::Interpolation)
+    return;
+
+  auto &inputs = m_inputTags[it->second];
+  if (!inputs.empty() && inputs.front() == parentTag) {
+    inputs.clear();
+    m_orderValid = false;
+  }
+}
+
+void AnimatedGraphEvaluator::SetValue(int64_t tag, double value) {
+  uint32_t slot = SlotOf(tag);
+  if (m_rawValues[slot] != value) {
+    m_rawValues[slot] = value;
+    MarkDirty(slot);
+  }
+}
+
+void AnimatedGraphEvaluator::SetOffset(int64_t tag, double offset) {
+  uint32_t slot = SlotOf(tag);
+  if (m_offsets[slot] != offset) {
+    m_offsets[slot] = offset;
+    MarkDirty(slot);
+  }
+}
+
+void AnimatedGraphEvaluator::FlattenOffset(int64_t tag) {
+  uint32_t slot = SlotOf(tag);
+  m_rawValues[slot] += m_offsets[slot];
+  m_offsets[slot] = 0.0;
+  MarkDirty(slot);
+}
+
+void AnimatedGraphEvaluator::ExtractOffset(int64_t tag) {
+  uint32_t slot = SlotOf(tag);
+  m_offsets[slot] += m_rawValues[slot];
+  m_rawValues[slot] = 0.0;
+  MarkDirty(slot);
+}
+
+double AnimatedGraphEvaluator::GetValue(int64_t tag) const {
+  uint32_t slot = SlotOf(tag);
+  return m_rawValues[slot] + m_offsets[slot];
+}
+
+double AnimatedGraphEvaluator::GetRawValue(int64_t tag) const {
+  return m_rawValues[SlotOf(tag)];
+}
+
+double AnimatedGraphEvaluator::GetOffset(int64_t tag) const {
+  return m_offsets[SlotOf(tag)];
+}
+
+size_t AnimatedGraphEvaluator::Update() {
+  if (!m_orderValid)
+    SortNodes();
+
+  if (!m_anyDirty)
+    return 0;
+
+  size_t updated = 0;
+  for (size_t i = 0; i < m_order.size(); ++i) {
+    uint32_t slot = m_order[i];
+    if (m_kinds[slot] == NodeKind::Value)
+      continue;
+
+    bool inputChanged = m_dirty[slot];
+    for (uint32_t input = m_inputStart[i]; !inputChanged && input < m_inputStart[i + 1]; ++input)
+      inputChanged = m_dirty[m_inputSlots[input]];
+
+    if (inputChanged) {
+      Evaluate(i);
+      m_dirty[slot] = true;
+      ++updated;
+    }
+  }
+
+  for (uint32_t slot : m_order)
+    m_dirty[slot] = false;
+  m_anyDirty = false;
+
+  return updated;
+}
+
+uint32_t AnimatedGraphEvaluator::SlotOf(int64_t tag) const {
+  return m_tagToSlot.at(tag);
+}
+
+void AnimatedGraphEvaluator::MarkDirty(uint32_t slot) {
+  m_dirty[slot] = true;
+  m_anyDirty = true;
+}
+
+void AnimatedGraphEvaluator::SortNodes() {
+  // Kahn's algorithm over the input edges of the live nodes
+  const uint32_t slotCount = static_cast<uint32_t>(m_tags.size());
+  std::vector<uint32_t> pendingInputs(slotCount, 0);
+  std::vector<std::vector<uint32_t>> dependents(slotCount);
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (!m_live[slot])
+      continue;
+
+    for (int64_t inputTag : m_inputTags[slot]) {
+      auto it = m_tagToSlot.find(inputTag);
+      if (it == m_tagToSlot.end())
+        continue;
+
+      dependents[it->second].push_back(slot);
+      ++pendingInputs[slot];
+    }
+  }
+
+  m_order.clear();
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (m_live[slot] && pendingInputs[slot] == 0)
+      m_order.push_back(slot);
+  }
+
+  for (size_t i = 0; i < m_order.size(); ++i) {
+    for (uint32_t dependent : dependents[m_order[i]]) {
+      if (--pendingInputs[dependent] == 0)
+        m_order.push_back(dependent);
+    }
+  }
+
+  // A cycle cannot be ordered; its nodes keep their last values.
+  assert(m_order.size() == m_tagToSlot.size());
+
+  // Inputs that do not exist read as zero and never change, so they are left
+  // out.
+  m_inputStart.clear();
+  m_inputSlots.clear();
+  for (uint32_t slot : m_order) {
+    m_inputStart.push_back(static_cast<uint32_t>(m_inputSlots.size()));
+    for (int64_t inputTag : m_inputTags[slot]) {
+      auto it = m_tagToSlot.find(inputTag);
+      if (it != m_tagToSlot.end())
+        m_inputSlots.push_back(it->second);
+    }
+  }
+  m_inputStart.push_back(static_cast<uint32_t>(m_inputSlots.size()));
+
+  m_orderValid = true;
+}
+
+void AnimatedGraphEvaluator::Evaluate(uint32_t orderIndex) {
+  const uint32_t slot = m_order[orderIndex];
+  const uint32_t *first = m_inputSlots.data() + m_inputStart[orderIndex];
+  const uint32_t *last = m_inputSlots.data() + m_inputStart[orderIndex + 1];
+  auto valueOf = [this](uint32_t input) { return m_rawValues[input] + m_offsets[input]; };
+
+  switch (m_kinds[slot]) {
+    case NodeKind::Addition: {
+      double sum = 0.0;
+      for (auto input = first; input != last; ++input)
+        sum += valueOf(*input);
+      m_rawValues[slot] = sum;
+      break;
+    }
+    case NodeKind::Subtraction: {
+      double difference = first != last ? valueOf(*first) : 0.0;
+      for (auto input = first + (first != last ? 1 : 0); input < last; ++input)
+        difference -= valueOf(*input);
+      m_rawValues[slot] = difference;
+      break;
+    }
+    case NodeKind::Multiplication: {
+      double product = 1.0;
+      for (auto input = first; input != last; ++input)
+        product *= valueOf(*input);
+      m_rawValues[slot] = product;
+      break;
+    }
+    case NodeKind::Division: {
+      double quotient = first != last ? valueOf(*first) : 0.0;
+      for (auto input = first + (first != last ? 1 : 0); input < last; ++input)
+        quotient /= valueOf(*input);
+      m_rawValues[slot] = quotient;
+      break;
+    }
+    case NodeKind::Modulus:
+      if (first != last)
+        m_rawValues[slot] = std::fmod(valueOf(*first), m_params0[slot]);
+      break;
+    case NodeKind::DiffClamp:
+      if (first != last) {
+        // Follows the change of the input, but stays within [min, max].
+        double input = valueOf(*first);
+        double value = std::isnan(m_lastInputs[slot]) ? input : m_rawValues[slot] + (input - m_lastInputs[slot]);
+        m_lastInputs[slot] = input;
+        m_rawValues[slot] = std::min(std::max(value, m_params0[slot]), m_params1[slot]);
+      }
+      break;
+    case NodeKind::Interpolation:
+      // Split like the composition backend: the raw value interpolates the
+      // parent's raw value, and the offset makes up the rest of the total.
+      if (first != last) {
+        const auto &config = m_interpolations[slot];
+        m_rawValues[slot] = Interpolate(config, m_rawValues[*first]);
+        m_offsets[slot] = Interpolate(config, valueOf(*first)) - m_rawValues[slot];
+      }
+      break;
+    case NodeKind::Value:
+      break;
+  }
+}
+
+double AnimatedGraphEvaluator::Interpolate(const InterpolationConfig &config, double value) const {
+  const auto &inputRange = config.inputRange;
+  const auto &outputRange = config.outputRange;
+  const size_t size = std::min(inputRange.size(), outputRange.size());
+  if (size == 0)
+    return value;
+  if (size == 1)
+    return outputRange[0];
+
+  size_t index = 1;
+  for (; index < size - 1; ++index) {
+    if (inputRange[index] >= value)
+      break;
+  }
+  --index;
+
+  double inputMin = inputRange[index];
+  double inputMax = inputRange[index + 1];
+  double outputMin = outputRange[index];
+  double outputMax = outputRange[index + 1];
+
+  if (value < inputMin) {
+    if (config.extrapolateLeft == Extrapolation::Identity)
+      return value;
+    if (config.extrapolateLeft == Extrapolation::Clamp)
+      value = inputMin;
+  }
+
+  if (value > inputMax) {
+    if (config.extrapolateRight == Extrapolation::Identity)
+      return value;
+    if (config.extrapolateRight == Extrapolation::Clamp)
+      value = inputMax;
+  }
+
+  if (outputMin == outputMax)
+    return outputMin;
+  if (inputMin == inputMax)
+    return value <= inputMin ? outputMin : outputMax;
+
+  return outputMin + (outputMax - outputMin) * (value - inputMin) / (inputMax - inputMin);
+}
+
+AnimatedGraphEvaluator::Extrapolation AnimatedGraphEvaluator::ExtrapolationFromString(const std::string &value) {
+  if (value == "identity")
+    return Extrapolation::Identity;
+  if (value == "clamp")
+    return Extrapolation::Clamp;
+  return Extrapolation::Extend;
+}
+
+} // namespace react
+} // namespace facebook
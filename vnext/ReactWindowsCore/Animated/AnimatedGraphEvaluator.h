@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Evaluates the native Animated value graph on the CPU. Nodes are created from
+// the same configs NativeAnimatedModule receives, values are kept in
+// struct-of-arrays storage, and Update() recomputes only the nodes downstream
+// of a changed value, in topological order.
+//
+// Only scalar nodes are evaluated (value, addition, subtraction,
+// multiplication, division, modulus, diffclamp and interpolation). Props,
+// style, transform and tracking nodes have no scalar value of their own and
+// are ignored.
+class AnimatedGraphEvaluator {
+ public:
+  // Returns false for node types that are not evaluated.
+  bool CreateNode(int64_t tag, const folly::dynamic &config);
+  void DropNode(int64_t tag);
+  bool HasNode(int64_t tag) const;
+
+  // Interpolation nodes take their input from the node they are connected to.
+  void ConnectNodes(int64_t parentTag, int64_t childTag);
+  void DisconnectNodes(int64_t parentTag, int64_t childTag);
+
+  void SetValue(int64_t tag, double value);
+  void SetOffset(int64_t tag, double offset);
+  void FlattenOffset(int64_t tag);
+  void ExtractOffset(int64_t tag);
+
+  double GetValue(int64_t tag) const; // Raw value plus offset
+  double GetRawValue(int64_t tag) const;
+  double GetOffset(int64_t tag) const;
+
+  // Recomputes every node that depends on a changed value. Returns the number
+  // of nodes recomputed.
+  size_t Update();
+
+ private:
+  enum class NodeKind : uint8_t {
+    Value,
+    Addition,
+    Subtraction,
+    Multiplication,
+    Division,
+    Modulus,
+    DiffClamp,
+    Interpolation,
+  };
+
+  enum class Extrapolation : uint8_t {
+    Identity,
+    Clamp,
+    Extend,
+  };
+
+  struct InterpolationConfig {
+    std::vector<double> inputRange;
+    std::vector<double> outputRange;
+    Extrapolation extrapolateLeft;
+    Extrapolation extrapolateRight;
+  };
+
+  uint32_t SlotOf(int64_t tag) const;
+  void MarkDirty(uint32_t slot);
+  void SortNodes();
+  void Evaluate(uint32_t orderIndex);
+  double Interpolate(const InterpolationConfig &config, double value) const;
+  static Extrapolation ExtrapolationFromString(const std::string &value);
+
+  std::unordered_map<int64_t, uint32_t> m_tagToSlot;
+  std::vector<uint32_t> m_freeSlots;
+
+  // Per-slot node storage
+  std::vector<int64_t> m_tags;
+  std::vector<NodeKind> m_kinds;
+  std::vector<double> m_rawValues;
+  std::vector<double> m_offsets;
+  std::vector<double> m_params0; // modulus, or diffclamp min
+  std::vector<double> m_params1; // diffclamp max
+  std::vector<double> m_lastInputs; // diffclamp input seen by the previous update
+  std::vector<uint8_t> m_dirty;
+  std::vector<uint8_t> m_live;
+  std::vector<std::vector<int64_t>> m_inputTags;
+  std::vector<InterpolationConfig> m_interpolations;
+
+  // Evaluation order and inputs resolved to slots, rebuilt when the graph
+  // changes. Inputs of m_order[i] are m_inputSlots[m_inputStart[i]..m_inputStart[i + 1]).
+  std::vector<uint32_t> m_order;
+  std::vector<uint32_t> m_inputStart;
+  std::vector<uint32_t> m_inputSlots;
+  bool m_orderValid = true;
+  bool m_anyDirty = false;
+};
+
+} // namespace react
+} // namespace facebook
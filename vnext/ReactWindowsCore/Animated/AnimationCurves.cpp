@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AnimationCurves.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr double c_infinity = std::numeric_limits<double>::infinity();
+
+// Time for amplitude * e^(-rate * t) to drop to threshold.
+double TimeToDecay(double amplitude, double threshold, double rate) noexcept {
+  if (amplitude <= threshold)
+    return 0.0;
+  if (threshold <= 0.0 || rate <= 0.0)
+    return c_infinity;
+  return std::log(amplitude / threshold) / rate;
+}
+
+} // namespace
+
+std::tuple<float, double> SpringValueAndVelocity(const SpringParameters &spring, double toValue, double time) noexcept {
+  const auto c = spring.damping;
+  const auto m = spring.mass;
+  const auto k = spring.stiffness;
+  const auto v0 = -spring.initialVelocity;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+  const auto x0 = toValue - spring.startValue;
+
+  if (zeta < 1) {
+    const auto envelope = std::exp(-zeta * omega0 * time);
+    const auto value = static_cast<float>(
+        toValue -
+        envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time)));
+    const auto velocity = zeta * omega0 * envelope *
+            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
+        envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
+    return std::make_tuple(value, velocity);
+  } else {
+    const auto envelope = std::exp(-omega0 * time);
+    const auto value = static_cast<float>(spring.endValue - envelope * (x0 + (v0 + omega0 * x0) * time));
+    const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+    return std::make_tuple(value, velocity);
+  }
+}
+
+double EstimateSpringSettleTime(
+    const SpringParameters &spring,
+    double restSpeedThreshold,
+    double restDisplacementThreshold) noexcept {
+  if (spring.stiffness <= 0.0 || spring.mass <= 0.0)
+    return c_infinity;
+
+  const auto zeta = spring.damping / (2 * std::sqrt(spring.stiffness * spring.mass));
+  const auto omega0 = std::sqrt(spring.stiffness / spring.mass);
+  const auto x0 = std::abs(spring.endValue - spring.startValue);
+  const auto v0 = -spring.initialVelocity;
+
+  double displacement, speed, rate;
+  if (zeta < 1) {
+    // x(t) = e^(-zeta * omega0 * t) * (A * sin(omega1 * t) + B * cos(omega1 * t))
+    const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+    const auto a = (v0 + zeta * omega0 * (spring.endValue - spring.startValue)) / omega1;
+    rate = zeta * omega0;
+    displacement = std::sqrt(a * a + x0 * x0);
+    speed = displacement * (rate + omega1);
+  } else {
+    // x(t) = e^(-omega0 * t) * (x0 + (v0 + omega0 * x0) * t), bounded using
+    // t * e^(-omega0 * t / 2) <= 2 / (e * omega0).
+    constexpr double e = 2.718281828459045;
+    rate = omega0 / 2;
+    displacement = x0 + 2 * std::abs(v0 + omega0 * (spring.endValue - spring.startValue)) / (e * omega0);
+    speed = std::abs(v0) + 2 * (std::abs(v0) + x0 * omega0) / e;
+  }
+
+  return std::max(
+      TimeToDecay(displacement, restDisplacementThreshold, rate), TimeToDecay(speed, restSpeedThreshold, rate));
+}
+
+double DecayValue(double startValue, double velocity, double deceleration, double time) noexcept {
+  return startValue + velocity / (1 - deceleration) * (1 - std::exp(-(1 - deceleration) * (1000 * time)));
+}
+
+double EstimateDecaySettleTime(double velocity, double deceleration, double restThreshold) noexcept {
+  if (deceleration >= 1.0)
+    return c_infinity;
+  return TimeToDecay(std::abs(velocity / (1 - deceleration)), restThreshold, (1 - deceleration) * 1000);
+}
+
+std::vector<Keyframe> GenerateKeyframes(
+    const std::function<std::tuple<float, double>(double time)> &valueAndVelocityForTime,
+    const std::function<bool(double value, double velocity)> &isDone,
+    double settleTime,
+    const KeyframeSamplingOptions &options) {
+  return GenerateKeyframes(
+      [&valueAndVelocityForTime](const double *times, size_t count, float *values, double *velocities) {
+        for (size_t i = 0; i < count; ++i)
+          std::tie(values[i], velocities[i]) = valueAndVelocityForTime(times[i]);
+      },
+      isDone,
+      settleTime,
+      options);
+}
+
+std::vector<Keyframe> GenerateKeyframes(
+    const CurveSampler &sampleCurve,
+    const std::function<bool(double value, double velocity)> &isDone,
+    double settleTime,
+    const KeyframeSamplingOptions &options) {
+  // The settle time is an upper bound; one extra frame absorbs rounding.
+  const double endTime = std::min(settleTime + options.frameInterval, options.maxDuration);
+
+  std::vector<Keyframe> samples;
+  samples.reserve(static_cast<size_t>(endTime / options.frameInterval) + 2);
+
+  // Frames are sampled in blocks; the samples past the one at rest are
+  // dropped.
+  constexpr size_t blockSize = 16;
+  double times[blockSize];
+  float values[blockSize];
+  double velocities[blockSize];
+  double minValue = c_infinity;
+  double maxValue = -c_infinity;
+  bool done = false;
+  for (size_t firstFrame = 0; !done; firstFrame += blockSize) {
+    for (size_t i = 0; i < blockSize; ++i)
+      times[i] = (firstFrame + i) * options.frameInterval;
+    sampleCurve(times, blockSize, values, velocities);
+
+    for (size_t i = 0; i < blockSize && !done; ++i) {
+      samples.push_back({times[i], values[i]});
+      minValue = std::min<double>(minValue, values[i]);
+      maxValue = std::max<double>(maxValue, values[i]);
+      done = firstFrame + i > 0 && (isDone(values[i], velocities[i]) || times[i] >= endTime);
+    }
+  }
+
+  const double range = maxValue - minValue;
+  double tolerance = std::max(range * options.relativeTolerance, options.absoluteTolerance);
+  const size_t maxKeyframes = std::max<size_t>(options.maxKeyframes, 2);
+
+  // Once the tolerance covers the whole range, the first and last samples
+  // alone are within it.
+  auto keyframes = SimplifyKeyframes(samples, tolerance);
+  while (keyframes.size() > maxKeyframes && tolerance <= range) {
+    tolerance = std::max(tolerance * 2, range / 64);
+    keyframes = SimplifyKeyframes(samples, tolerance);
+  }
+
+  return keyframes;
+}
+
+std::vector<Keyframe> SimplifyKeyframes(const std::vector<Keyframe> &samples, double tolerance) {
+  if (samples.size() <= 2)
+    return samples;
+
+  std::vector<Keyframe> keyframes;
+  keyframes.push_back(samples.front());
+
+  // From each kept keyframe, extend the segment to the furthest sample such
+  // that the line to it passes within tolerance of every sample in between.
+  // The slopes satisfying all samples seen so far form the interval [low, high].
+  size_t anchor = 0;
+  while (anchor < samples.size() - 1) {
+    const auto &start = samples[anchor];
+    double low = -c_infinity;
+    double high = c_infinity;
+    size_t end = anchor + 1;
+    for (size_t i = anchor + 1; i < samples.size(); ++i) {
+      const double dt = samples[i].time - start.time;
+      const double slope = (samples[i].value - start.value) / dt;
+      if (slope >= low && slope <= high)
+        end = i;
+
+      low = std::max(low, (samples[i].value - tolerance - start.value) / dt);
+      high = std::min(high, (samples[i].value + tolerance - start.value) / dt);
+      if (low > high)
+        break;
+    }
+
+    keyframes.push_back(samples[end]);
+    anchor = end;
+  }
+
+  return keyframes;
+}
+
+} // namespace react
+} // namespace facebook
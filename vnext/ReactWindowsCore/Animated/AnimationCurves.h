@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+struct SpringParameters {
+  double stiffness = 0.0;
+  double damping = 0.0;
+  double mass = 1.0;
+  double initialVelocity = 0.0; // Units per second
+  double startValue = 0.0;
+  double endValue = 0.0;
+};
+
+// Value and velocity of a damped spring moving from startValue to toValue,
+// time seconds after it was released.
+std::tuple<float, double> SpringValueAndVelocity(const SpringParameters &spring, double toValue, double time) noexcept;
+
+// Upper bound on the time the spring needs to come within the rest thresholds
+// of its end value. Infinite if it never comes to rest.
+double EstimateSpringSettleTime(
+    const SpringParameters &spring,
+    double restSpeedThreshold,
+    double restDisplacementThreshold) noexcept;
+
+// Value of a decay animation time seconds after it started. Velocity is in
+// units per millisecond, as sent by Animated.
+double DecayValue(double startValue, double velocity, double deceleration, double time) noexcept;
+
+// Time a decay animation needs to come within restThreshold of its end value.
+double EstimateDecaySettleTime(double velocity, double deceleration, double restThreshold) noexcept;
+
+struct Keyframe {
+  double time; // Seconds since the start of the animation
+  double value;
+};
+
+struct KeyframeSamplingOptions {
+  double frameInterval = 1.0 / 60.0;
+
+  // Keyframes are interpolated linearly. They may deviate from the sampled
+  // curve by relativeTolerance of the distance the curve covers, but never
+  // by less than absoluteTolerance.
+  double relativeTolerance = 0.001;
+  double absoluteTolerance = 0.001;
+
+  // Hard limits for curves that settle late or never do.
+  size_t maxKeyframes = 120;
+  double maxDuration = 30.0;
+};
+
+// Samples the curve once per frame until isDone reports it at rest (or the
+// settle time / maxDuration is reached) and returns the fewest keyframes that
+// stay within the tolerance of the samples. The first and last samples are
+// always kept.
+std::vector<Keyframe> GenerateKeyframes(
+    const std::function<std::tuple<float, double>(double time)> &valueAndVelocityForTime,
+    const std::function<bool(double value, double velocity)> &isDone,
+    double settleTime,
+    const KeyframeSamplingOptions &options);
+
+// Evaluates the curve at count times at once.
+using CurveSampler = std::function<void(const double *times, size_t count, float *values, double *velocities)>;
+
+// Same as above, sampling the curve in batches.
+std::vector<Keyframe> GenerateKeyframes(
+    const CurveSampler &sampleCurve,
+    const std::function<bool(double value, double velocity)> &isDone,
+    double settleTime,
+    const KeyframeSamplingOptions &options);
+
+// Reduces the samples to the fewest keyframes whose linear interpolation is
+// within tolerance of every sample.
+std::vector<Keyframe> SimplifyKeyframes(const std::vector<Keyframe> &samples, double tolerance);
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AnimationStats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+double ToMilliseconds(std::chrono::nanoseconds duration) noexcept {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+void Log2Histogram::Add(double value) noexcept {
+  value = std::max(value, 0.0);
+
+  size_t bucket = 0;
+  if (value >= 1.0) {
+    int exponent;
+    std::frexp(value, &exponent);
+    bucket = std::min<size_t>(static_cast<size_t>(exponent), c_bucketCount - 1);
+  }
+
+  ++buckets[bucket];
+  ++count;
+  sum += value;
+  max = std::max(max, value);
+}
+
+double Log2Histogram::Mean() const noexcept {
+  return count ? sum / count : 0.0;
+}
+
+double Log2Histogram::Percentile(double fraction) const noexcept {
+  if (!count)
+    return 0.0;
+
+  const auto rank = static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * count));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < c_bucketCount - 1; ++i) {
+    seen += buckets[i];
+    if (seen >= std::max<uint64_t>(rank, 1))
+      return std::min(std::ldexp(1.0, static_cast<int>(i)), max);
+  }
+  return max;
+}
+
+uint64_t CountDroppedFrames(
+    std::chrono::nanoseconds actualDuration,
+    std::chrono::nanoseconds expectedDuration,
+    std::chrono::nanoseconds frameInterval) noexcept {
+  if (frameInterval.count() <= 0 || actualDuration <= expectedDuration)
+    return 0;
+  return static_cast<uint64_t>((actualDuration - expectedDuration) / frameInterval);
+}
+
+void AnimationStats::RecordStart(std::chrono::nanoseconds startLatency, size_t keyframeCount) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.started;
+  m_stats.startLatencyMs.Add(ToMilliseconds(startLatency));
+  m_stats.keyframes.Add(static_cast<double>(keyframeCount));
+}
+
+void AnimationStats::RecordFinish(std::chrono::nanoseconds duration, uint64_t droppedFrames) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.finished;
+  m_stats.droppedFrames += droppedFrames;
+  m_stats.durationMs.Add(ToMilliseconds(duration));
+  m_stats.droppedFramesPerAnimation.Add(static_cast<double>(droppedFrames));
+}
+
+void AnimationStats::RecordStop() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.stopped;
+}
+
+AnimationStatsSnapshot AnimationStats::GetSnapshot() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+void AnimationStats::Reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats = {};
+}
+
+} // namespace react
+} // namespace facebook
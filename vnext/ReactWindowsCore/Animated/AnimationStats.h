@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace facebook {
+namespace react {
+
+// Counts values in power-of-two buckets: bucket 0 holds values below 1,
+// bucket i values in [2^(i-1), 2^i) and the last bucket everything larger.
+struct Log2Histogram {
+  static constexpr size_t c_bucketCount = 16;
+
+  std::array<uint64_t, c_bucketCount> buckets{};
+  uint64_t count{0};
+  double sum{0.0};
+  double max{0.0};
+
+  void Add(double value) noexcept;
+  double Mean() const noexcept;
+
+  // Upper bound of the bucket holding the given fraction (0..1] of the
+  // values, capped at the largest value. 0 when empty.
+  double Percentile(double fraction) const noexcept;
+};
+
+struct AnimationStatsSnapshot {
+  uint64_t started{0};
+  uint64_t finished{0};
+  uint64_t stopped{0};
+  uint64_t droppedFrames{0};
+
+  // From the startAnimatingNode call to the composition batch starting.
+  Log2Histogram startLatencyMs;
+  // From the composition batch starting to it completing, for animations
+  // that finished.
+  Log2Histogram durationMs;
+  Log2Histogram droppedFramesPerAnimation;
+  Log2Histogram keyframes;
+};
+
+// Frames by which an animation completed later than its keyframes said it
+// would, as composition only reports when the whole batch is done.
+uint64_t CountDroppedFrames(
+    std::chrono::nanoseconds actualDuration,
+    std::chrono::nanoseconds expectedDuration,
+    std::chrono::nanoseconds frameInterval) noexcept;
+
+// Aggregates timings of native driven animations. Safe to record and poll
+// from different threads.
+class AnimationStats {
+ public:
+  void RecordStart(std::chrono::nanoseconds startLatency, size_t keyframeCount);
+  void RecordFinish(std::chrono::nanoseconds duration, uint64_t droppedFrames);
+  void RecordStop();
+
+  AnimationStatsSnapshot GetSnapshot() const;
+  void Reset();
+
+ private:
+  mutable std::mutex m_mutex;
+  AnimationStatsSnapshot m_stats;
+};
+
+} // namespace react
+} // namespace facebook
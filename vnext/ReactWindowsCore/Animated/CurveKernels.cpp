@@ -0,0 +1,359 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "CurveKernels.h"
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CURVE_KERNELS_AVX2
+#elif defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CURVE_KERNELS_SSE2
+#endif
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+#if defined(CURVE_KERNELS_AVX2) || defined(CURVE_KERNELS_SSE2)
+
+// Adding 1.5 * 2^52 rounds a double below 2^51 in magnitude to the nearest
+// integer and leaves that integer in the low mantissa bits.
+constexpr double c_roundingShifter = 6755399441055744.0;
+constexpr int64_t c_roundingShifterLowBits = int64_t{1} << 51;
+
+constexpr double c_log2e = 1.4426950408889634;
+constexpr double c_ln2Hi = 6.93147180369123816490e-01;
+constexpr double c_ln2Lo = 1.90821492927058770002e-10;
+
+// Taylor series of e^r to degree 13, below double precision for |r| <= ln 2 / 2.
+constexpr double c_exp[] = {
+    1.0,
+    1.0,
+    1.0 / 2,
+    1.0 / 6,
+    1.0 / 24,
+    1.0 / 120,
+    1.0 / 720,
+    1.0 / 5040,
+    1.0 / 40320,
+    1.0 / 362880,
+    1.0 / 3628800,
+    1.0 / 39916800,
+    1.0 / 479001600,
+    1.0 / 6227020800,
+};
+
+constexpr double c_twoOverPi = 6.36619772367581382433e-01;
+constexpr double c_piOverTwo1 = 1.57079632673412561417e+00;
+constexpr double c_piOverTwo2 = 6.07710050630396597660e-11;
+constexpr double c_piOverTwo3 = 2.02226624879595063154e-21;
+
+// Minimax polynomials for sin and cos on [-pi/4, pi/4], as used by fdlibm.
+constexpr double c_sin[] = {
+    -1.66666666666666324348e-01,
+    8.33333333332248946124e-03,
+    -1.98412698298579493134e-04,
+    2.75573137070700676789e-06,
+    -2.50507602534068634195e-08,
+    1.58969099521155010221e-10,
+};
+constexpr double c_cos[] = {
+    4.16666666666666019037e-02,
+    -1.38888888888741095749e-03,
+    2.48015872894767294178e-05,
+    -2.75573143513906633035e-07,
+    2.08757232129817482790e-09,
+    -1.13596475577881948265e-11,
+};
+
+#if defined(CURVE_KERNELS_AVX2)
+
+struct Vector {
+  using V = __m256d;
+  static constexpr size_t Width = 4;
+
+  static V Set(double value) noexcept {
+    return _mm256_set1_pd(value);
+  }
+  static V Load(const double *source) noexcept {
+    return _mm256_loadu_pd(source);
+  }
+  static void Store(double *destination, V value) noexcept {
+    _mm256_storeu_pd(destination, value);
+  }
+  static V Add(V a, V b) noexcept {
+    return _mm256_add_pd(a, b);
+  }
+  static V Sub(V a, V b) noexcept {
+    return _mm256_sub_pd(a, b);
+  }
+  static V Mul(V a, V b) noexcept {
+    return _mm256_mul_pd(a, b);
+  }
+  static V Min(V a, V b) noexcept {
+    return _mm256_min_pd(a, b);
+  }
+  static V Max(V a, V b) noexcept {
+    return _mm256_max_pd(a, b);
+  }
+  static V And(V a, V b) noexcept {
+    return _mm256_and_pd(a, b);
+  }
+  static V Xor(V a, V b) noexcept {
+    return _mm256_xor_pd(a, b);
+  }
+  // mask ? a : b, for masks of all ones or all zeros per lane.
+  static V Select(V mask, V a, V b) noexcept {
+    return _mm256_blendv_pd(b, a, mask);
+  }
+  static V AddToBits(V value, int64_t addend) noexcept {
+    return _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(value), _mm256_set1_epi64x(addend)));
+  }
+  template <int Bits>
+  static V ShiftBitsLeft(V value) noexcept {
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(value), Bits));
+  }
+  // All ones in the lanes whose sign bit is set.
+  static V SignMask(V value) noexcept {
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_castpd_si256(value)));
+  }
+};
+
+#else
+
+struct Vector {
+  using V = __m128d;
+  static constexpr size_t Width = 2;
+
+  static V Set(double value) noexcept {
+    return _mm_set1_pd(value);
+  }
+  static V Load(const double *source) noexcept {
+    return _mm_loadu_pd(source);
+  }
+  static void Store(double *destination, V value) noexcept {
+    _mm_storeu_pd(destination, value);
+  }
+  static V Add(V a, V b) noexcept {
+    return _mm_add_pd(a, b);
+  }
+  static V Sub(V a, V b) noexcept {
+    return _mm_sub_pd(a, b);
+  }
+  static V Mul(V a, V b) noexcept {
+    return _mm_mul_pd(a, b);
+  }
+  static V Min(V a, V b) noexcept {
+    return _mm_min_pd(a, b);
+  }
+  static V Max(V a, V b) noexcept {
+    return _mm_max_pd(a, b);
+  }
+  static V And(V a, V b) noexcept {
+    return _mm_and_pd(a, b);
+  }
+  static V Xor(V a, V b) noexcept {
+    return _mm_xor_pd(a, b);
+  }
+  // mask ? a : b, for masks of all ones or all zeros per lane.
+  static V Select(V mask, V a, V b) noexcept {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+  }
+  static V AddToBits(V value, int64_t addend) noexcept {
+    return _mm_castsi128_pd(_mm_add_epi64(_mm_castpd_si128(value), _mm_set1_epi64x(addend)));
+  }
+  template <int Bits>
+  static V ShiftBitsLeft(V value) noexcept {
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(value), Bits));
+  }
+  // All ones in the lanes whose sign bit is set. SSE2 has no 64-bit compare,
+  // so the high 32 bits are sign-extended and copied to the low half.
+  static V SignMask(V value) noexcept {
+    const __m128i high = _mm_srai_epi32(_mm_castpd_si128(value), 31);
+    return _mm_castsi128_pd(_mm_shuffle_epi32(high, _MM_SHUFFLE(3, 3, 1, 1)));
+  }
+};
+
+#endif
+
+using V = Vector::V;
+
+V Exp(V x) noexcept {
+  // e^x = 2^k * e^r with k = round(x / ln 2) and |r| <= ln 2 / 2. The clamp
+  // keeps 2^k a normal double; the curves only need the low end for
+  // envelopes that have decayed to nothing.
+  x = Vector::Max(Vector::Min(x, Vector::Set(709.0)), Vector::Set(-708.0));
+  const V shifted = Vector::Add(Vector::Mul(x, Vector::Set(c_log2e)), Vector::Set(c_roundingShifter));
+  const V k = Vector::Sub(shifted, Vector::Set(c_roundingShifter));
+  const V r = Vector::Sub(Vector::Sub(x, Vector::Mul(k, Vector::Set(c_ln2Hi))), Vector::Mul(k, Vector::Set(c_ln2Lo)));
+
+  V polynomial = Vector::Set(c_exp[13]);
+  for (int n = 12; n >= 0; --n)
+    polynomial = Vector::Add(Vector::Mul(polynomial, r), Vector::Set(c_exp[n]));
+
+  // 2^k, built from the integer k held in the low bits of shifted.
+  const V scale = Vector::ShiftBitsLeft<52>(Vector::AddToBits(shifted, 1023 - c_roundingShifterLowBits));
+  return Vector::Mul(polynomial, scale);
+}
+
+void SinCos(V x, V &sine, V &cosine) noexcept {
+  // x = q * pi / 2 + r, with pi / 2 split in three parts so that the
+  // reduction stays exact for the arguments the curves produce.
+  const V shifted = Vector::Add(Vector::Mul(x, Vector::Set(c_twoOverPi)), Vector::Set(c_roundingShifter));
+  const V q = Vector::Sub(shifted, Vector::Set(c_roundingShifter));
+  V r = Vector::Sub(x, Vector::Mul(q, Vector::Set(c_piOverTwo1)));
+  r = Vector::Sub(r, Vector::Mul(q, Vector::Set(c_piOverTwo2)));
+  r = Vector::Sub(r, Vector::Mul(q, Vector::Set(c_piOverTwo3)));
+
+  const V z = Vector::Mul(r, r);
+  V sinPolynomial = Vector::Set(c_sin[5]);
+  V cosPolynomial = Vector::Set(c_cos[5]);
+  for (int n = 4; n >= 0; --n) {
+    sinPolynomial = Vector::Add(Vector::Mul(sinPolynomial, z), Vector::Set(c_sin[n]));
+    cosPolynomial = Vector::Add(Vector::Mul(cosPolynomial, z), Vector::Set(c_cos[n]));
+  }
+  const V sinR = Vector::Add(r, Vector::Mul(Vector::Mul(r, z), sinPolynomial));
+  const V cosR = Vector::Add(
+      Vector::Sub(Vector::Set(1.0), Vector::Mul(Vector::Set(0.5), z)), Vector::Mul(Vector::Mul(z, z), cosPolynomial));
+
+  // The low bits of shifted hold q. Odd quadrants swap sin and cos, sin is
+  // negative in quadrants 2 and 3, and cos in quadrants 1 and 2.
+  const V signBit = Vector::Set(-0.0);
+  const V swap = Vector::SignMask(Vector::ShiftBitsLeft<63>(shifted));
+  const V sinSign = Vector::And(Vector::ShiftBitsLeft<62>(shifted), signBit);
+  const V cosSign = Vector::And(Vector::ShiftBitsLeft<62>(Vector::AddToBits(shifted, 1)), signBit);
+  sine = Vector::Xor(Vector::Select(swap, cosR, sinR), sinSign);
+  cosine = Vector::Xor(Vector::Select(swap, sinR, cosR), cosSign);
+}
+
+// Evaluates whole vectors of times and returns how many were done.
+size_t SpringKernel(
+    const SpringParameters &spring,
+    const double *times,
+    size_t count,
+    float *values,
+    double *velocities) noexcept {
+  const auto c = spring.damping;
+  const auto m = spring.mass;
+  const auto k = spring.stiffness;
+  const auto v0 = -spring.initialVelocity;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto x0 = spring.endValue - spring.startValue;
+
+  const size_t vectorCount = count - count % Vector::Width;
+  double valueLanes[Vector::Width];
+  if (zeta < 1) {
+    const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+    const auto a = (v0 + zeta * omega0 * x0) / omega1;
+    const V decayRate = Vector::Set(-zeta * omega0);
+    for (size_t i = 0; i < vectorCount; i += Vector::Width) {
+      const V time = Vector::Load(times + i);
+      const V envelope = Exp(Vector::Mul(decayRate, time));
+      V sine, cosine;
+      SinCos(Vector::Mul(Vector::Set(omega1), time), sine, cosine);
+
+      const V oscillation = Vector::Add(Vector::Mul(Vector::Set(a), sine), Vector::Mul(Vector::Set(x0), cosine));
+      Vector::Store(valueLanes, Vector::Sub(Vector::Set(spring.endValue), Vector::Mul(envelope, oscillation)));
+      const V velocity = Vector::Sub(
+          Vector::Mul(Vector::Set(zeta * omega0), Vector::Mul(envelope, oscillation)),
+          Vector::Mul(
+              envelope,
+              Vector::Sub(
+                  Vector::Mul(cosine, Vector::Set(v0 + zeta * omega0 * x0)),
+                  Vector::Mul(Vector::Set(omega1 * x0), sine))));
+      Vector::Store(velocities + i, velocity);
+      for (size_t lane = 0; lane < Vector::Width; ++lane)
+        values[i + lane] = static_cast<float>(valueLanes[lane]);
+    }
+  } else {
+    const V decayRate = Vector::Set(-omega0);
+    for (size_t i = 0; i < vectorCount; i += Vector::Width) {
+      const V time = Vector::Load(times + i);
+      const V envelope = Exp(Vector::Mul(decayRate, time));
+      const V displacement = Vector::Add(Vector::Set(x0), Vector::Mul(Vector::Set(v0 + omega0 * x0), time));
+      Vector::Store(valueLanes, Vector::Sub(Vector::Set(spring.endValue), Vector::Mul(envelope, displacement)));
+      const V velocity = Vector::Mul(
+          envelope,
+          Vector::Add(
+              Vector::Mul(Vector::Set(v0), Vector::Sub(Vector::Mul(time, Vector::Set(omega0)), Vector::Set(1.0))),
+              Vector::Mul(time, Vector::Set(x0 * omega0 * omega0))));
+      Vector::Store(velocities + i, velocity);
+      for (size_t lane = 0; lane < Vector::Width; ++lane)
+        values[i + lane] = static_cast<float>(valueLanes[lane]);
+    }
+  }
+
+  return vectorCount;
+}
+
+size_t DecayKernel(
+    double startValue,
+    double velocity,
+    double deceleration,
+    const double *times,
+    size_t count,
+    double *values) noexcept {
+  const size_t vectorCount = count - count % Vector::Width;
+  const V distance = Vector::Set(velocity / (1 - deceleration));
+  const V rate = Vector::Set(-(1 - deceleration) * 1000);
+  for (size_t i = 0; i < vectorCount; i += Vector::Width) {
+    const V remaining = Vector::Sub(Vector::Set(1.0), Exp(Vector::Mul(rate, Vector::Load(times + i))));
+    Vector::Store(values + i, Vector::Add(Vector::Set(startValue), Vector::Mul(distance, remaining)));
+  }
+  return vectorCount;
+}
+
+#else
+
+size_t SpringKernel(const SpringParameters &, const double *, size_t, float *, double *) noexcept {
+  return 0;
+}
+
+size_t DecayKernel(double, double, double, const double *, size_t, double *) noexcept {
+  return 0;
+}
+
+#endif
+
+} // namespace
+
+void SpringValuesAndVelocities(
+    const SpringParameters &spring,
+    const double *times,
+    size_t count,
+    float *values,
+    double *velocities) noexcept {
+  for (size_t i = SpringKernel(spring, times, count, values, velocities); i < count; ++i)
+    std::tie(values[i], velocities[i]) = SpringValueAndVelocity(spring, spring.endValue, times[i]);
+}
+
+void DecayValues(
+    double startValue,
+    double velocity,
+    double deceleration,
+    const double *times,
+    size_t count,
+    double *values) noexcept {
+  for (size_t i = DecayKernel(startValue, velocity, deceleration, times, count, values); i < count; ++i)
+    values[i] = DecayValue(startValue, velocity, deceleration, times[i]);
+}
+
+const char *CurveKernelInstructionSet() noexcept {
+#if defined(CURVE_KERNELS_AVX2)
+  return "avx2";
+#elif defined(CURVE_KERNELS_SSE2)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
+
+} // namespace react
+} // namespace facebook
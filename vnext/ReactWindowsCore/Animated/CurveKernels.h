@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "AnimationCurves.h"
+
+#include <cstddef>
+
+namespace facebook {
+namespace react {
+
+// Batch versions of the curve formulas in AnimationCurves.h. They evaluate
+// several samples per instruction with AVX2 when the build targets it, SSE2
+// on other x86/x64 builds and one sample at a time elsewhere. Results match
+// the scalar formulas to within a few units in the last place.
+
+// Same as SpringValueAndVelocity(spring, spring.endValue, times[i]) for each
+// of the count times.
+void SpringValuesAndVelocities(
+    const SpringParameters &spring,
+    const double *times,
+    size_t count,
+    float *values,
+    double *velocities) noexcept;
+
+// Same as DecayValue(startValue, velocity, deceleration, times[i]) for each
+// of the count times.
+void DecayValues(
+    double startValue,
+    double velocity,
+    double deceleration,
+    const double *times,
+    size_t count,
+    double *values) noexcept;
+
+// "avx2", "sse2" or "scalar".
+const char *CurveKernelInstructionSet() noexcept;
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "KeyframeCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace facebook {
+namespace react {
+
+KeyframeCache::KeyframeCache(size_t capacity) noexcept : m_capacity(std::max<size_t>(capacity, 1)) {}
+
+KeyframeCache::Curve KeyframeCache::GetOrCreate(
+    const std::vector<double> &key,
+    const std::function<std::vector<Keyframe>()> &generate) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+      ++m_stats.hits;
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return it->second->second;
+    }
+    ++m_stats.misses;
+  }
+
+  // Generated without the lock held; if another thread cached the same curve
+  // meanwhile, the first one stays.
+  auto curve = std::make_shared<const std::vector<Keyframe>>(generate());
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_index.find(key);
+  if (it != m_index.end())
+    return it->second->second;
+
+  m_entries.emplace_front(key, curve);
+  m_index.emplace(key, m_entries.begin());
+  if (m_entries.size() > m_capacity) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+    ++m_stats.evictions;
+  }
+
+  return curve;
+}
+
+void KeyframeCache::Clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_index.clear();
+  m_entries.clear();
+}
+
+KeyframeCacheStats KeyframeCache::GetStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+size_t KeyframeCache::KeyHash::operator()(const std::vector<double> &key) const noexcept {
+  size_t hash = key.size();
+  for (double value : key) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    hash ^= std::hash<uint64_t>{}(bits) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+bool KeyframeCache::KeyEqual::operator()(const std::vector<double> &left, const std::vector<double> &right) const
+    noexcept {
+  return left.size() == right.size() &&
+      (left.empty() || std::memcmp(left.data(), right.data(), left.size() * sizeof(double)) == 0);
+}
+
+} // namespace react
+} // namespace facebook
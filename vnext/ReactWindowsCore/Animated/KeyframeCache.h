@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "AnimationCurves.h"
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+struct KeyframeCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+};
+
+// Bounded least-recently-used cache of keyframe curves. Callers store curves
+// normalized to the distance they cover, keyed by every parameter that
+// determines the normalized shape, and scale them to the start and end values
+// of each animation.
+class KeyframeCache {
+ public:
+  using Curve = std::shared_ptr<const std::vector<Keyframe>>;
+
+  explicit KeyframeCache(size_t capacity = 64) noexcept;
+
+  // Returns the cached curve for key, or calls generate and caches its result.
+  // Keys are compared bitwise.
+  Curve GetOrCreate(const std::vector<double> &key, const std::function<std::vector<Keyframe>()> &generate);
+
+  void Clear();
+  KeyframeCacheStats GetStats() const;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const std::vector<double> &key) const noexcept;
+  };
+  struct KeyEqual {
+    bool operator()(const std::vector<double> &left, const std::vector<double> &right) const noexcept;
+  };
+
+  using Entry = std::pair<std::vector<double>, Curve>;
+
+  const size_t m_capacity;
+  mutable std::mutex m_mutex;
+  std::list<Entry> m_entries; // Most recently used first
+  std::unordered_map<std::vector<double>, std::list<Entry>::iterator, KeyHash, KeyEqual> m_index;
+  KeyframeCacheStats m_stats;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "NativeAnimatedEvent.h"
+
+#include <string_view>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+struct EventPathEntry {
+  std::string_view object;
+  std::string_view property;
+  NativeEventField field;
+};
+
+constexpr EventPathEntry c_nestedPaths[] = {
+    {"contentOffset", "x", NativeEventField::ContentOffsetX},
+    {"contentOffset", "y", NativeEventField::ContentOffsetY},
+    {"contentInset", "left", NativeEventField::ContentInsetLeft},
+    {"contentInset", "top", NativeEventField::ContentInsetTop},
+    {"contentInset", "right", NativeEventField::ContentInsetRight},
+    {"contentInset", "bottom", NativeEventField::ContentInsetBottom},
+    {"contentSize", "width", NativeEventField::ContentSizeWidth},
+    {"contentSize", "height", NativeEventField::ContentSizeHeight},
+    {"layoutMeasurement", "width", NativeEventField::LayoutMeasurementWidth},
+    {"layoutMeasurement", "height", NativeEventField::LayoutMeasurementHeight},
+};
+
+constexpr EventPathEntry c_topLevelPaths[] = {
+    {{}, "zoomScale", NativeEventField::ZoomScale},
+    {{}, "pageX", NativeEventField::PageX},
+    {{}, "pageY", NativeEventField::PageY},
+    {{}, "locationX", NativeEventField::LocationX},
+    {{}, "locationY", NativeEventField::LocationY},
+};
+
+} // namespace
+
+std::optional<NativeEventField> CompileNativeEventPath(const std::vector<std::string> &path) noexcept {
+  if (path.size() == 1) {
+    for (const auto &entry : c_topLevelPaths) {
+      if (path[0] == entry.property)
+        return entry.field;
+    }
+  } else if (path.size() == 2) {
+    for (const auto &entry : c_nestedPaths) {
+      if (path[0] == entry.object && path[1] == entry.property)
+        return entry.field;
+    }
+  }
+
+  return std::nullopt;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Event payload fields that views can hand to animated event drivers
+// directly, without building the folly::dynamic payload sent to JS.
+enum class NativeEventField : uint8_t {
+  ContentOffsetX,
+  ContentOffsetY,
+  ContentInsetLeft,
+  ContentInsetTop,
+  ContentInsetRight,
+  ContentInsetBottom,
+  ContentSizeWidth,
+  ContentSizeHeight,
+  LayoutMeasurementWidth,
+  LayoutMeasurementHeight,
+  ZoomScale,
+  PageX,
+  PageY,
+  LocationX,
+  LocationY,
+  Count,
+};
+
+// Resolves an Animated.event nativeEventPath, such as ["contentOffset", "y"],
+// to the field it reads. Returns nullopt for paths native events don't carry.
+std::optional<NativeEventField> CompileNativeEventPath(const std::vector<std::string> &path) noexcept;
+
+// The fields of one native event. Fields the source did not set read as
+// missing.
+class NativeAnimatedEvent {
+ public:
+  void Set(NativeEventField field, double value) noexcept {
+    m_values[static_cast<size_t>(field)] = value;
+    m_present |= 1u << static_cast<uint32_t>(field);
+  }
+
+  std::optional<double> Get(NativeEventField field) const noexcept {
+    if (!(m_present & (1u << static_cast<uint32_t>(field))))
+      return std::nullopt;
+    return m_values[static_cast<size_t>(field)];
+  }
+
+ private:
+  static_assert(static_cast<size_t>(NativeEventField::Count) <= 32, "Presence mask holds 32 fields");
+
+  std::array<double, static_cast<size_t>(NativeEventField::Count)> m_values{};
+  uint32_t m_present{0};
+};
+
+} // namespace react
+} // namespace facebook
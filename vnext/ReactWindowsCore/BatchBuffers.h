@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+// Two buffers for batches that one thread fills and hands to a queue that
+// runs them. The filling side switches to the other buffer with each batch,
+// and takes a buffer back once the batch that held it is released. So once
+// both buffers are warm, batching allocates nothing.
+//
+// A buffer that is still held when its turn comes, because the queue fell
+// two batches behind, is replaced with a new one. The same happens to a
+// buffer whose batch was released without running all of its tasks.
+//
+// TBuffer must have IsEmpty(). Not thread-safe; only the filling thread
+// calls into it, the running side only releases its shared_ptr.
+template <typename TBuffer>
+class BatchBuffers {
+ public:
+  // The buffer that collects the current batch.
+  TBuffer &Current() {
+    auto &buffer = m_buffers[m_current];
+    if (!m_isFilling) {
+      m_isFilling = true;
+      if (!IsReleased(buffer))
+        buffer = std::make_shared<TBuffer>();
+    }
+    return *buffer;
+  }
+
+  // True if Current was called since the last TakeBatch.
+  bool HasBatch() const noexcept {
+    return m_isFilling;
+  }
+
+  // The current batch to hand over. Null if there is none.
+  std::shared_ptr<TBuffer> TakeBatch() {
+    if (!m_isFilling)
+      return nullptr;
+
+    m_isFilling = false;
+    auto batch = m_buffers[m_current];
+    m_current ^= 1;
+    return batch;
+  }
+
+ private:
+  static bool IsReleased(const std::shared_ptr<TBuffer> &buffer) noexcept {
+    if (!buffer || buffer.use_count() != 1)
+      return false;
+
+    // Pairs with the release of the last shared_ptr on the running thread.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return buffer->IsEmpty();
+  }
+
+ private:
+  std::array<std::shared_ptr<TBuffer>, 2> m_buffers;
+  size_t m_current{0};
+  bool m_isFilling{false};
+};
+
+} // namespace react
+} // namespace facebook
@@ -11,6 +11,7 @@ namespace facebook {
 namespace react {
 
 class MessageQueueueThread;
+class TimerStats;
 
 // This method is to create a unique_ptr of native timing module.
 // @param A MessageQueueThread on which this native module lives.
@@ -18,5 +19,13 @@ class MessageQueueueThread;
 std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
     const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread) noexcept;
 
+// As above, for timers that may fire up to timerSlackMs late so that timers due
+// close together are batched. The module publishes its counters to stats, if
+// given.
+std::unique_ptr<facebook::xplat::module::CxxModule> CreateTimingModule(
+    const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread,
+    double timerSlackMs,
+    std::shared_ptr<TimerStats> stats) noexcept;
+
 } // namespace react
 } // namespace facebook
@@ -2,11 +2,11 @@
 // Licensed under the MIT License.
 
 #include "CxxMessageQueue.h"
+#include "NodePool.h"
 
 #include <folly/AtomicIntrusiveLinkedList.h>
 
 #include <mutex>
-#include <queue>
 #include <unordered_map>
 
 #include <glog/logging.h>
@@ -20,24 +20,29 @@ using detail::EventFlag;
 using clock = std::chrono::steady_clock;
 using time_point = clock::time_point;
 static_assert(std::is_same<time_point, EventFlag::time_point>::value, "");
+static_assert(std::is_same<time_point, DelayedTaskQueue::TimePoint>::value, "");
 
 namespace {
 time_point now() {
   return clock::now();
 }
 
+class Task;
+
+// Tasks are posted by the thousand during startup; their nodes are recycled
+// rather than allocated for each post. The callable is moved into the node,
+// and std::function keeps small lambdas inline, so a typical post allocates
+// nothing once the pool is warm.
+using TaskPool = NodePool<Task>;
+
 class Task {
  public:
-  static Task *create(std::function<void()> &&func) {
-    return new Task{std::move(func), false, time_point()};
+  static Task *create(TaskPool &pool, std::function<void()> &&func, TaskPriority priority, time_point posted) {
+    return pool.Create(Task{std::move(func), false, priority, posted});
   }
 
-  static Task *createSync(std::function<void()> &&func) {
-    return new Task{std::move(func), true, time_point()};
-  }
-
-  static Task *createDelayed(std::function<void()> &&func, time_point startTime) {
-    return new Task{std::move(func), false, startTime};
+  static Task *createSync(TaskPool &pool, std::function<void()> &&func, time_point posted) {
+    return pool.Create(Task{std::move(func), true, TaskPriority::Normal, posted});
   }
 
   std::function<void()> func;
@@ -46,81 +51,73 @@ class Task {
   // the synchronous task might never resume. We use this flag to detect this
   // case and throw an error.
   bool sync;
-  time_point startTime;
+  TaskPriority priority;
+  // Only set when the queue records stats.
+  time_point posted;
 
   folly::AtomicIntrusiveLinkedListHook<Task> hook;
-
-  // Should this sort consider id also?
-  struct Compare {
-    bool operator()(const Task *a, const Task *b) {
-      return a->startTime > b->startTime;
-    }
-  };
 };
 
-class DelayedTaskQueue {
+// Returns an owned task to its pool.
+class TaskDeleter {
  public:
-  ~DelayedTaskQueue() {
-    while (!queue_.empty()) {
-      delete queue_.top();
-      queue_.pop();
-    }
-  }
+  explicit TaskDeleter(TaskPool &pool) : pool_(&pool) {}
 
-  void process() {
-    while (!queue_.empty()) {
-      Task *d = queue_.top();
-      if (now() < d->startTime) {
-        break;
-      }
-      auto owned = std::unique_ptr<Task>(queue_.top());
-      queue_.pop();
-      owned->func();
-    }
-  }
-
-  void push(Task *t) {
-    queue_.push(t);
-  }
-
-  bool empty() {
-    return queue_.empty();
-  }
-
-  time_point nextTime() {
-    return queue_.top()->startTime;
+  void operator()(Task *t) const noexcept {
+    pool_->Destroy(t);
   }
 
  private:
-  std::priority_queue<Task *, std::vector<Task *>, Task::Compare> queue_;
+  TaskPool *pool_;
 };
 
+using OwnedTask = std::unique_ptr<Task, TaskDeleter>;
+
 } // namespace
 
 class CxxMessageQueue::QueueRunner {
  public:
+  QueueRunner(std::shared_ptr<QueueStats> stats, size_t maxPooledTasks)
+      : stats_(std::move(stats)), pool_(maxPooledTasks) {}
+
   ~QueueRunner() {
-    queue_.sweep([](Task *t) { delete t; });
+    // The tasks that never ran are recorded as canceled, or the depth of the
+    // stats would count them forever.
+    takePosted();
+    while (!lanes_.IsEmpty()) {
+      lanes_.Pop();
+      if (stats_) {
+        stats_->RecordCancel();
+      }
+    }
   }
 
-  void enqueue(std::function<void()> &&func) {
-    enqueueTask(Task::create(std::move(func)));
+  void enqueue(std::function<void()> &&func, TaskPriority priority = TaskPriority::Normal) {
+    enqueueTask(Task::create(pool_, std::move(func), priority, postTime()));
   }
 
-  void enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
-    if (delayMs) {
-      enqueueTask(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)));
-    } else {
+  DelayedTaskHandle enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
+    if (!delayMs) {
       enqueue(std::move(func));
+      return DelayedTaskHandle();
     }
+
+    // Wake the runloop so that it waits for the new task if it is the
+    // earliest.
+    auto handle = delayed_->Post(std::move(func), now() + std::chrono::milliseconds(delayMs));
+    pending_.set();
+    return handle;
   }
 
   void enqueueSync(std::function<void()> &&func) {
     EventFlag done;
-    enqueueTask(Task::createSync([&]() mutable {
-      func();
-      done.set();
-    }));
+    enqueueTask(Task::createSync(
+        pool_,
+        [&]() mutable {
+          func();
+          done.set();
+        },
+        postTime()));
     if (stopped_) {
       // If this queue is stopped_, the sync task might never actually run.
       throw std::runtime_error("Stopped within enqueueSync.");
@@ -152,10 +149,12 @@ class CxxMessageQueue::QueueRunner {
     // matter reading stopped_.
     while (!stopped_.load(std::memory_order_relaxed)) {
       sweep();
-      if (delayed_.empty()) {
-        pending_.wait();
+      // Another thread may cancel the earliest task at any time, so its due
+      // time is read once.
+      if (auto nextTime = delayed_->NextTime()) {
+        pending_.wait_until(*nextTime);
       } else {
-        pending_.wait_until(delayed_.nextTime());
+        pending_.wait();
       }
     }
     // This sweep is just to catch erroneous enqueueSync. That is, there could
@@ -166,29 +165,37 @@ class CxxMessageQueue::QueueRunner {
   }
 
   // We are processing two queues, the posted tasks (queue_) and the delayed
-  // tasks (delayed_). Delayed tasks first go into posted tasks, and then are
-  // moved to the delayed queue if we pop them before the time they are
-  // scheduled for.
+  // tasks (delayed_). Delayed tasks go straight into the delayed queue, where
+  // they can be cancelled until they run.
   // As we pop things from queue_, before dealing with that thing, we run any
   // delayed tasks whose scheduled time has arrived.
+  // Posted tasks are sorted into lanes_ by priority, and picked up again
+  // after every task so that urgent work does not wait for the rest.
   void sweep() {
-    queue_.sweep([this](Task *t) {
-      std::unique_ptr<Task> owned(t);
+    takePosted();
+    while (!lanes_.IsEmpty()) {
+      OwnedTask owned = lanes_.Pop();
       if (stopped_.load(std::memory_order_relaxed)) {
-        if (t->sync) {
+        if (stats_) {
+          stats_->RecordCancel();
+        }
+        if (owned->sync) {
           throw std::runtime_error("Sync task posted while stopped.");
         }
-        return;
+        continue;
       }
 
-      delayed_.process();
-      if (t->startTime != time_point() && now() <= t->startTime) {
-        delayed_.push(owned.release());
+      delayed_->RunDue(now());
+      if (stats_) {
+        const auto start = now();
+        owned->func();
+        stats_->RecordTask(start - owned->posted, now() - start);
       } else {
-        t->func();
+        owned->func();
       }
-    });
-    delayed_.process();
+      takePosted();
+    }
+    delayed_->RunDue(now());
   }
 
   void bindToThisThread() {
@@ -203,6 +210,19 @@ class CxxMessageQueue::QueueRunner {
   }
 
  private:
+  // The clock is only read when the queue records stats.
+  time_point postTime() {
+    if (!stats_) {
+      return time_point{};
+    }
+    stats_->RecordPost();
+    return now();
+  }
+
+  void takePosted() {
+    queue_.sweep([this](Task *t) { lanes_.Push(t->priority, OwnedTask(t, TaskDeleter(pool_))); });
+  }
+
   void enqueueTask(Task *task) {
     if (queue_.insertHead(task)) {
       pending_.set();
@@ -210,17 +230,23 @@ class CxxMessageQueue::QueueRunner {
   }
 
   std::thread::id tid_;
+  const std::shared_ptr<QueueStats> stats_;
+
+  // Declared first so that it outlives the tasks in queue_ and lanes_.
+  TaskPool pool_;
 
   folly::AtomicIntrusiveLinkedList<Task, &Task::hook> queue_;
+  TaskLanes<OwnedTask> lanes_;
 
   std::atomic_bool stopped_{false};
-  DelayedTaskQueue delayed_;
+  std::shared_ptr<DelayedTaskQueue> delayed_{std::make_shared<DelayedTaskQueue>()};
 
   BinarySemaphore pending_;
   EventFlag finished_;
 };
 
-CxxMessageQueue::CxxMessageQueue() : qr_(new QueueRunner()) {}
+CxxMessageQueue::CxxMessageQueue(std::shared_ptr<QueueStats> stats, size_t maxPooledTasks)
+    : qr_(new QueueRunner(std::move(stats), maxPooledTasks)) {}
 
 CxxMessageQueue::~CxxMessageQueue() {
   // TODO(cjhopman): Add detach() so that the queue doesn't have to be
@@ -234,8 +260,12 @@ void CxxMessageQueue::runOnQueue(std::function<void()> &&func) {
   qr_->enqueue(std::move(func));
 }
 
-void CxxMessageQueue::runOnQueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
-  qr_->enqueueDelayed(std::move(func), delayMs);
+void CxxMessageQueue::runOnQueueWithPriority(TaskPriority priority, std::function<void()> &&func) {
+  qr_->enqueue(std::move(func), priority);
+}
+
+DelayedTaskHandle CxxMessageQueue::runOnQueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
+  return qr_->enqueueDelayed(std::move(func), delayMs);
 }
 
 void CxxMessageQueue::runOnQueueSync(std::function<void()> &&func) {
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <DelayedTaskQueue.h>
+#include <PriorityMessageQueue.h>
+#include <QueueStats.h>
 #include <cxxreact/MessageQueueThread.h>
 
 #include <atomic>
@@ -51,12 +54,24 @@ using BinarySemaphore = CVFlag<true>;
 using EventFlag = CVFlag<false>;
 } // namespace detail
 
-class CxxMessageQueue : public MessageQueueThread {
+class CxxMessageQueue : public MessageQueueThread, public IPriorityMessageQueue {
  public:
-  CxxMessageQueue();
+  // The nodes of up to this many posted tasks are recycled; beyond that, and
+  // with 0, each task is allocated on the heap. The pool keeps its slabs
+  // while the queue lives, so the default covers the steady state and leaves
+  // bursts to the heap.
+  static constexpr size_t c_defaultMaxPooledTasks = 4 * 1024;
+
+  // With stats, the queue records the wait and run time of its posted tasks.
+  explicit CxxMessageQueue(
+      std::shared_ptr<QueueStats> stats = nullptr,
+      size_t maxPooledTasks = c_defaultMaxPooledTasks);
   virtual ~CxxMessageQueue() override;
   virtual void runOnQueue(std::function<void()> &&) override;
-  void runOnQueueDelayed(std::function<void()> &&, uint64_t delayMs);
+  virtual void runOnQueueWithPriority(TaskPriority priority, std::function<void()> &&) override;
+  // The returned handle cancels the task until it runs. Tasks without a
+  // delay are posted right away and cannot be cancelled.
+  DelayedTaskHandle runOnQueueDelayed(std::function<void()> &&, uint64_t delayMs);
   // runOnQueueSync and quitSynchronous are dangerous.  They should only be
   // used for initialization and cleanup.
   virtual void runOnQueueSync(std::function<void()> &&) override;
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "DelayedTaskQueue.h"
+
+#include <cassert>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+DelayedTaskHandle::DelayedTaskHandle(std::weak_ptr<DelayedTaskQueue> queue, int64_t id) noexcept
+    : m_queue(std::move(queue)), m_id(id) {}
+
+bool DelayedTaskHandle::Cancel() {
+  auto queue = m_queue.lock();
+  m_queue.reset();
+  return queue && queue->Cancel(m_id);
+}
+
+DelayedTaskHandle DelayedTaskQueue::Post(std::function<void()> &&func, TimePoint dueTime) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const int64_t id = m_nextId++;
+  m_tasks.emplace(id, std::move(func));
+  m_heap.Push({id, dueTime, {}, false});
+  return DelayedTaskHandle(weak_from_this(), id);
+}
+
+bool DelayedTaskQueue::Cancel(int64_t id) {
+  std::function<void()> func;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_heap.Remove(id))
+      return false;
+
+    auto found = m_tasks.find(id);
+    func = std::move(found->second);
+    m_tasks.erase(found);
+  }
+  // The closure is destroyed here, outside the lock.
+  return true;
+}
+
+void DelayedTaskQueue::RunDue(TimePoint now) {
+  while (true) {
+    std::function<void()> func;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_heap.IsEmpty() || m_heap.Front().DueTime > now)
+        return;
+
+      auto found = m_tasks.find(m_heap.Front().Id);
+      assert(found != m_tasks.end());
+      m_heap.Pop();
+      func = std::move(found->second);
+      m_tasks.erase(found);
+    }
+    func();
+  }
+}
+
+bool DelayedTaskQueue::IsEmpty() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_heap.IsEmpty();
+}
+
+size_t DelayedTaskQueue::Size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_heap.Size();
+}
+
+std::optional<DelayedTaskQueue::TimePoint> DelayedTaskQueue::NextTime() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_heap.IsEmpty())
+    return std::nullopt;
+  return m_heap.Front().DueTime;
+}
+
+} // namespace react
+} // namespace facebook
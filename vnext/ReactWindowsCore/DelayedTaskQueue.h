@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <TimerHeap.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+class DelayedTaskQueue;
+
+// Cancels a task posted to a DelayedTaskQueue. A default-constructed handle
+// refers to no task.
+class DelayedTaskHandle {
+ public:
+  DelayedTaskHandle() = default;
+
+  // Removes the task and releases its closure. Returns false if the task
+  // already ran, was cancelled, or its queue is gone.
+  bool Cancel();
+
+ private:
+  friend class DelayedTaskQueue;
+  DelayedTaskHandle(std::weak_ptr<DelayedTaskQueue> queue, int64_t id) noexcept;
+
+  std::weak_ptr<DelayedTaskQueue> m_queue;
+  int64_t m_id{0};
+};
+
+// The delayed tasks of a message queue, ordered by due time in an indexed
+// heap so that a task is cancelled in O(log n). Any thread may post and
+// cancel; one thread runs the tasks. Tasks due at the same time run in the
+// order they were posted. Times are passed in, so tests can drive it with
+// a fake clock.
+class DelayedTaskQueue : public std::enable_shared_from_this<DelayedTaskQueue> {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  DelayedTaskHandle Post(std::function<void()> &&func, TimePoint dueTime);
+  bool Cancel(int64_t id);
+
+  // Runs the tasks due at or before now, earliest first. A task may post or
+  // cancel other tasks.
+  void RunDue(TimePoint now);
+
+  bool IsEmpty() const;
+  size_t Size() const;
+
+  // Due time of the earliest task, if any.
+  std::optional<TimePoint> NextTime() const;
+
+ private:
+  mutable std::mutex m_mutex;
+  TimerHeap<TimePoint> m_heap;
+  std::unordered_map<int64_t, std::function<void()>> m_tasks;
+  int64_t m_nextId{1};
+};
+
+} // namespace react
+} // namespace facebook
@@ -23,6 +23,8 @@ struct RuntimeHolderLazyInit;
 namespace facebook {
 namespace react {
 
+class TimerStats;
+
 enum class JSExceptionType : int32_t {
   Fatal = 0,
   Soft = 1,
@@ -97,6 +99,19 @@ struct DevSettings {
   // Enables ChakraCore console redirection to debugger
   bool debuggerConsoleRedirection{false};
 
+  /// Queues view events until the JS thread is ready for them, merging
+  /// consecutive scroll and mouse move events for the same view so that only
+  /// the latest payload is dispatched. On UWP it also raises onMouseMove for
+  /// hover moves, which are not sent without coalescing.
+  bool enableEventCoalescing{false};
+
+  /// Lets the Timing module fire a timer up to this many ms after its due
+  /// time, so that timers due close together wake it up once.
+  double timerSlackMs{0};
+
+  /// Receives the Timing module's timer batching counters.
+  std::shared_ptr<TimerStats> timerStats;
+
   /// Dispatcher for notifications about JS engine memory consumption.
   std::shared_ptr<MemoryTracker> memoryTracker;
 
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "EventCoalescingQueue.h"
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+int64_t TargetOf(const folly::dynamic &eventData) {
+  if (eventData.isObject()) {
+    auto target = eventData.get_ptr("target");
+    if (target != nullptr && target->isInt())
+      return target->getInt();
+  }
+
+  return -1;
+}
+
+} // namespace
+
+bool EventCoalescingQueue::IsCoalescable(const std::string &eventName) noexcept {
+  return eventName == "topScroll" || eventName == "topMouseMove";
+}
+
+bool EventCoalescingQueue::Enqueue(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) {
+  bool coalescable = IsCoalescable(eventName);
+  int64_t target = coalescable ? TargetOf(eventData) : -1;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.enqueuedEvents;
+
+  auto lastIt = m_lastPendingForView.find(viewTag);
+  if (coalescable && lastIt != m_lastPendingForView.end()) {
+    PendingEvent &last = m_pending[lastIt->second];
+    if (last.coalescable && last.target == target && last.event.eventName == eventName) {
+      last.event.eventData = std::move(eventData);
+      ++m_stats.mergedEvents;
+      return false;
+    }
+  }
+
+  m_lastPendingForView[viewTag] = m_pending.size();
+  m_pending.push_back({{viewTag, std::move(eventName), std::move(eventData)}, target, coalescable});
+
+  if (m_flushScheduled)
+    return false;
+
+  m_flushScheduled = true;
+  return true;
+}
+
+void EventCoalescingQueue::Flush(const std::function<void(Event &&)> &dispatch) {
+  std::vector<PendingEvent> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pending.swap(m_pending);
+    m_lastPendingForView.clear();
+    m_flushScheduled = false;
+    ++m_stats.flushes;
+    m_stats.dispatchedEvents += pending.size();
+  }
+
+  for (auto &pendingEvent : pending)
+    dispatch(std::move(pendingEvent.event));
+}
+
+void EventCoalescingQueue::Drop() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.droppedEvents += m_pending.size();
+  m_pending.clear();
+  m_lastPendingForView.clear();
+  m_flushScheduled = false;
+}
+
+EventCoalescingStats EventCoalescingQueue::GetStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+struct EventCoalescingStats {
+  uint64_t enqueuedEvents = 0;
+  uint64_t mergedEvents = 0; // Replaced by a later event before being dispatched
+  uint64_t droppedEvents = 0; // Discarded because the instance went away
+  uint64_t dispatchedEvents = 0;
+  uint64_t flushes = 0;
+};
+
+// Holds the events raised for views until the JS thread is ready for them.
+// A coalescable event (scroll, mouse move) that directly follows a pending
+// event with the same name and target for the same view replaces its payload,
+// so JS only sees the latest state. Events are dispatched in the order raised.
+class EventCoalescingQueue {
+ public:
+  struct Event {
+    int64_t viewTag;
+    std::string eventName;
+    folly::dynamic eventData;
+  };
+
+  static bool IsCoalescable(const std::string &eventName) noexcept;
+
+  // Returns true when the queue had no flush pending. The caller is expected
+  // to schedule one.
+  bool Enqueue(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData);
+
+  // Hands all pending events to dispatch, in order.
+  void Flush(const std::function<void(Event &&)> &dispatch);
+
+  // Discards all pending events.
+  void Drop();
+
+  EventCoalescingStats GetStats() const;
+
+ private:
+  struct PendingEvent {
+    Event event;
+    int64_t target;
+    bool coalescable;
+  };
+
+  mutable std::mutex m_mutex;
+  std::vector<PendingEvent> m_pending;
+  std::unordered_map<int64_t, size_t> m_lastPendingForView;
+  bool m_flushScheduled = false;
+  EventCoalescingStats m_stats;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,249 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "HitTestIndex.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr float c_cellSize = 64.0f;
+constexpr float c_minDeterminant = 1e-6f;
+
+} // namespace
+
+HitTestTransform HitTestTransform::Translation(float x, float y) noexcept {
+  HitTestTransform result;
+  result.offsetX = x;
+  result.offsetY = y;
+  return result;
+}
+
+HitTestTransform HitTestTransform::Then(const HitTestTransform &other) const noexcept {
+  HitTestTransform result;
+  result.m11 = m11 * other.m11 + m12 * other.m21;
+  result.m12 = m11 * other.m12 + m12 * other.m22;
+  result.m21 = m21 * other.m11 + m22 * other.m21;
+  result.m22 = m21 * other.m12 + m22 * other.m22;
+  result.offsetX = offsetX * other.m11 + offsetY * other.m21 + other.offsetX;
+  result.offsetY = offsetX * other.m12 + offsetY * other.m22 + other.offsetY;
+  return result;
+}
+
+bool HitTestTransform::TryInvert(HitTestTransform &inverse) const noexcept {
+  float determinant = m11 * m22 - m12 * m21;
+  if (std::fabs(determinant) < c_minDeterminant)
+    return false;
+
+  inverse.m11 = m22 / determinant;
+  inverse.m12 = -m12 / determinant;
+  inverse.m21 = -m21 / determinant;
+  inverse.m22 = m11 / determinant;
+  inverse.offsetX = -(offsetX * inverse.m11 + offsetY * inverse.m21);
+  inverse.offsetY = -(offsetX * inverse.m12 + offsetY * inverse.m22);
+  return true;
+}
+
+void HitTestTransform::Apply(float x, float y, float &outX, float &outY) const noexcept {
+  outX = x * m11 + y * m21 + offsetX;
+  outY = x * m12 + y * m22 + offsetY;
+}
+
+void HitTestIndex::BeginRoot(int64_t rootTag, float width, float height) {
+  assert(m_building == nullptr);
+
+  // Rebuilding a root reuses the storage of its previous index.
+  RootIndex &root = m_roots[rootTag];
+  root.width = width;
+  root.height = height;
+  root.columns = std::max(1, static_cast<int32_t>(std::ceil(width / c_cellSize)));
+  root.rows = std::max(1, static_cast<int32_t>(std::ceil(height / c_cellSize)));
+  root.entries.clear();
+  root.cells.resize(static_cast<size_t>(root.columns) * root.rows);
+  for (auto &cell : root.cells)
+    cell.clear();
+
+  m_building = &root;
+  m_buildingTagToEntry.clear();
+}
+
+void HitTestIndex::AddNode(const HitTestNode &node) {
+  assert(m_building != nullptr);
+
+  int32_t parentIndex = -1;
+  HitTestTransform parentToRoot;
+  if (node.parentTag != -1) {
+    auto it = m_buildingTagToEntry.find(node.parentTag);
+    if (it == m_buildingTagToEntry.end())
+      return;
+
+    const Entry &parent = m_building->entries[it->second];
+    if (!parent.childrenHitTestable)
+      return;
+
+    parentIndex = it->second;
+    parentToRoot = parent.localToRoot;
+  } else if (!m_building->entries.empty()) {
+    // Only one node per root may be parentless
+    assert(false);
+    return;
+  }
+
+  if (node.pointerEvents == PointerEvents::None)
+    return;
+
+  Entry entry;
+  entry.tag = node.tag;
+  entry.parent = parentIndex;
+  entry.localToRoot = node.transform.Then(HitTestTransform::Translation(node.left, node.top)).Then(parentToRoot);
+  // A collapsed transform (e.g. scale 0) hides the node and its children.
+  if (!entry.localToRoot.TryInvert(entry.rootToLocal))
+    return;
+  entry.width = node.width;
+  entry.height = node.height;
+  entry.pointerEvents = node.pointerEvents;
+  entry.contentOutsideLayout = node.contentOutsideLayout;
+  entry.childrenHitTestable = !node.contentOutsideLayout &&
+      (node.pointerEvents == PointerEvents::Auto || node.pointerEvents == PointerEvents::BoxNone);
+
+  uint32_t entryIndex = static_cast<uint32_t>(m_building->entries.size());
+  m_building->entries.push_back(entry);
+  m_buildingTagToEntry[node.tag] = static_cast<int32_t>(entryIndex);
+
+  if (node.pointerEvents != PointerEvents::BoxNone)
+    InsertIntoCells(*m_building, entryIndex);
+}
+
+void HitTestIndex::EndRoot() {
+  assert(m_building != nullptr);
+  m_building = nullptr;
+  m_buildingTagToEntry.clear();
+}
+
+void HitTestIndex::RemoveRoot(int64_t rootTag) {
+  assert(m_building == nullptr);
+  m_roots.erase(rootTag);
+}
+
+void HitTestIndex::Clear() {
+  assert(m_building == nullptr);
+  m_roots.clear();
+}
+
+bool HitTestIndex::HasRoot(int64_t rootTag) const {
+  return m_roots.find(rootTag) != m_roots.end();
+}
+
+HitTestIndex::Result HitTestIndex::HitTest(int64_t rootTag, float x, float y, std::vector<int64_t> &targetChain)
+    const {
+  targetChain.clear();
+
+  auto it = m_roots.find(rootTag);
+  if (it == m_roots.end())
+    return Result::Unresolved;
+
+  const RootIndex &root = it->second;
+  const std::vector<uint32_t> *cell = CellAt(root, x, y);
+  if (cell == nullptr)
+    return Result::Miss;
+
+  // Cells list entries in paint order, so the topmost target is the last one
+  // containing the point.
+  for (auto entryIt = cell->rbegin(); entryIt != cell->rend(); ++entryIt) {
+    const Entry &entry = root.entries[*entryIt];
+    if (!Contains(entry, x, y))
+      continue;
+
+    if (entry.contentOutsideLayout)
+      return Result::Unresolved;
+
+    for (int32_t index = static_cast<int32_t>(*entryIt); index != -1; index = root.entries[index].parent)
+      targetChain.push_back(root.entries[index].tag);
+    return Result::Hit;
+  }
+
+  return Result::Miss;
+}
+
+HitTestIndex::Result HitTestIndex::TagsAtPoint(int64_t rootTag, float x, float y, std::set<int64_t> &tags) const {
+  tags.clear();
+
+  auto it = m_roots.find(rootTag);
+  if (it == m_roots.end())
+    return Result::Unresolved;
+
+  const RootIndex &root = it->second;
+  const std::vector<uint32_t> *cell = CellAt(root, x, y);
+  if (cell == nullptr)
+    return Result::Miss;
+
+  for (uint32_t entryIndex : *cell) {
+    const Entry &entry = root.entries[entryIndex];
+    if (!Contains(entry, x, y))
+      continue;
+
+    // Targets inside the node are not known to the index
+    if (entry.contentOutsideLayout) {
+      tags.clear();
+      return Result::Unresolved;
+    }
+
+    tags.insert(entry.tag);
+  }
+
+  return tags.empty() ? Result::Miss : Result::Hit;
+}
+
+const std::vector<uint32_t> *HitTestIndex::CellAt(const RootIndex &root, float x, float y) const noexcept {
+  if (!(x >= 0.0f && y >= 0.0f && x < root.width && y < root.height))
+    return nullptr;
+
+  int32_t column = std::min(static_cast<int32_t>(x / c_cellSize), root.columns - 1);
+  int32_t row = std::min(static_cast<int32_t>(y / c_cellSize), root.rows - 1);
+  return &root.cells[static_cast<size_t>(row) * root.columns + column];
+}
+
+bool HitTestIndex::Contains(const Entry &entry, float x, float y) noexcept {
+  float localX, localY;
+  entry.rootToLocal.Apply(x, y, localX, localY);
+  return localX >= 0.0f && localY >= 0.0f && localX < entry.width && localY < entry.height;
+}
+
+void HitTestIndex::InsertIntoCells(RootIndex &root, uint32_t entryIndex) {
+  const Entry &entry = root.entries[entryIndex];
+  if (!(entry.width > 0.0f && entry.height > 0.0f))
+    return;
+
+  // Bounding box of the transformed frame, in root coordinates
+  const float corners[4][2] = {{0.0f, 0.0f}, {entry.width, 0.0f}, {0.0f, entry.height}, {entry.width, entry.height}};
+  float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+  for (const auto &corner : corners) {
+    float x, y;
+    entry.localToRoot.Apply(corner[0], corner[1], x, y);
+    minX = std::min(minX, x);
+    minY = std::min(minY, y);
+    maxX = std::max(maxX, x);
+    maxY = std::max(maxY, y);
+  }
+
+  if (maxX < 0.0f || maxY < 0.0f || minX >= root.width || minY >= root.height)
+    return;
+
+  int32_t firstColumn = std::max(0, static_cast<int32_t>(std::floor(minX / c_cellSize)));
+  int32_t lastColumn = std::min(root.columns - 1, static_cast<int32_t>(std::floor(maxX / c_cellSize)));
+  int32_t firstRow = std::max(0, static_cast<int32_t>(std::floor(minY / c_cellSize)));
+  int32_t lastRow = std::min(root.rows - 1, static_cast<int32_t>(std::floor(maxY / c_cellSize)));
+
+  for (int32_t row = firstRow; row <= lastRow; ++row) {
+    for (int32_t column = firstColumn; column <= lastColumn; ++column)
+      root.cells[static_cast<size_t>(row) * root.columns + column].push_back(entryIndex);
+  }
+}
+
+} // namespace react
+} // namespace facebook
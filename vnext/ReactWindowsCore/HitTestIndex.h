@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+enum class PointerEvents {
+  Auto,
+  None,
+  BoxNone,
+  BoxOnly,
+};
+
+// 2D affine transform in the row-vector convention used by XAML matrices:
+//   x' = x * m11 + y * m21 + offsetX
+//   y' = x * m12 + y * m22 + offsetY
+struct HitTestTransform {
+  float m11 = 1.0f;
+  float m12 = 0.0f;
+  float m21 = 0.0f;
+  float m22 = 1.0f;
+  float offsetX = 0.0f;
+  float offsetY = 0.0f;
+
+  static HitTestTransform Translation(float x, float y) noexcept;
+
+  // Returns the transform that applies this one and then other.
+  HitTestTransform Then(const HitTestTransform &other) const noexcept;
+  bool TryInvert(HitTestTransform &inverse) const noexcept;
+  void Apply(float x, float y, float &outX, float &outY) const noexcept;
+};
+
+struct HitTestNode {
+  int64_t tag = -1;
+  int64_t parentTag = -1; // -1 for the root node
+
+  // Frame relative to the parent node, as laid out by Yoga.
+  float left = 0.0f;
+  float top = 0.0f;
+  float width = 0.0f;
+  float height = 0.0f;
+
+  // Render transform in node coordinates, applied before the frame offset.
+  HitTestTransform transform;
+  PointerEvents pointerEvents = PointerEvents::Auto;
+
+  // The node positions its children outside of Yoga layout (e.g. scrolled
+  // content). Its children are not indexed and hits on it are unresolved.
+  bool contentOutsideLayout = false;
+};
+
+// Spatial index over the laid out frames of each root view, used to resolve
+// pointer targets without walking the platform view tree. Each root is a
+// uniform grid of cells listing the nodes whose bounds overlap the cell, in
+// paint order.
+class HitTestIndex {
+ public:
+  enum class Result {
+    Miss,
+    Hit,
+    Unresolved, // The index cannot answer; fall back to platform hit testing.
+  };
+
+  // Nodes are added parents first, with siblings in paint order. Nodes whose
+  // parent was not added, or cannot have hit-testable children, are ignored.
+  void BeginRoot(int64_t rootTag, float width, float height);
+  void AddNode(const HitTestNode &node);
+  void EndRoot();
+
+  void RemoveRoot(int64_t rootTag);
+  void Clear();
+  bool HasRoot(int64_t rootTag) const;
+
+  // Finds the topmost target at a point in root coordinates. On a hit,
+  // targetChain holds the target tag followed by its ancestors up to the root.
+  Result HitTest(int64_t rootTag, float x, float y, std::vector<int64_t> &targetChain) const;
+
+  // Collects the tags of every target under a point in root coordinates.
+  Result TagsAtPoint(int64_t rootTag, float x, float y, std::set<int64_t> &tags) const;
+
+ private:
+  struct Entry {
+    int64_t tag;
+    int32_t parent;
+    HitTestTransform localToRoot;
+    HitTestTransform rootToLocal;
+    float width;
+    float height;
+    PointerEvents pointerEvents;
+    bool contentOutsideLayout;
+    bool childrenHitTestable;
+  };
+
+  struct RootIndex {
+    float width = 0.0f;
+    float height = 0.0f;
+    int32_t columns = 0;
+    int32_t rows = 0;
+    std::vector<Entry> entries;
+    std::vector<std::vector<uint32_t>> cells;
+  };
+
+  const std::vector<uint32_t> *CellAt(const RootIndex &root, float x, float y) const noexcept;
+  static bool Contains(const Entry &entry, float x, float y) noexcept;
+  void InsertIntoCells(RootIndex &root, uint32_t entryIndex);
+
+  std::unordered_map<int64_t, RootIndex> m_roots;
+
+  // State of the root being built
+  RootIndex *m_building = nullptr;
+  std::unordered_map<int64_t, int32_t> m_buildingTagToEntry;
+};
+
+} // namespace react
+} // namespace facebook
@@ -70,6 +70,16 @@ struct INativeUIManager {
       float x,
       float y,
       facebook::xplat::module::CxxModule::Callback callback) = 0;
+
+  // Layout-only view flattening. Views whose props only affect layout can be
+  // kept as Yoga-only nodes instead of creating a native view.
+  virtual bool isLayoutOnlyView(const std::string & /*className*/, const folly::dynamic & /*props*/) {
+    return false;
+  }
+  virtual bool canHostLayoutOnlyChildren(ShadowNode & /*nativeParent*/) {
+    return false;
+  }
+  virtual void OnLayoutOnlyViewPromoted(ShadowNode & /*shadowNode*/) {}
 };
 
 } // namespace react
@@ -18,6 +18,13 @@ class IViewManager;
 struct ShadowNode;
 class MessageQueueThread;
 
+struct LayoutOnlyViewStats {
+  // Views currently kept as Yoga-only nodes.
+  size_t flattenedViews{0};
+  // Views that were created layout-only and later needed a native view.
+  size_t promotedViews{0};
+};
+
 class IUIManager {
  public:
   virtual ~IUIManager(){};
@@ -65,6 +72,8 @@ class IUIManager {
       int64_t reactTag,
       folly::dynamic &&coordinates,
       facebook::xplat::module::CxxModule::Callback callback) = 0;
+
+  virtual LayoutOnlyViewStats getLayoutOnlyViewStats() = 0;
 };
 
 std::shared_ptr<IUIManager> createIUIManager(
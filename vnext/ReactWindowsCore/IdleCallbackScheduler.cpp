@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "IdleCallbackScheduler.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+IdleCallbackScheduler::IdleCallbackScheduler(Duration frameInterval, Duration minimumIdleTime) noexcept
+    : m_frameInterval(frameInterval), m_minimumIdleTime(minimumIdleTime) {}
+
+void IdleCallbackScheduler::SetEnabled(bool enabled) noexcept {
+  // Frames are not observed while idle events are off, so the gap to the
+  // next frame says nothing about overruns.
+  if (enabled && !m_enabled)
+    m_hasPreviousFrame = false;
+  m_enabled = enabled;
+}
+
+void IdleCallbackScheduler::BeginFrame(TimePoint frameStart) noexcept {
+  // A frame overran if its own work ran past the deadline, or if the next
+  // frame came so late that a whole frame was missed.
+  m_previousFrameOverran = m_hasPreviousFrame &&
+      ((m_inFrame ? frameStart : m_workDone) > m_frameStart + m_frameInterval ||
+       frameStart - m_frameStart > 2 * m_frameInterval);
+
+  m_frameStart = frameStart;
+  m_inFrame = true;
+  m_hasPreviousFrame = true;
+  ++m_stats.frames;
+}
+
+bool IdleCallbackScheduler::EndFrameWork(TimePoint now) noexcept {
+  if (!m_inFrame)
+    return false;
+  m_inFrame = false;
+  m_workDone = now;
+
+  if (!m_enabled)
+    return false;
+
+  if (m_previousFrameOverran) {
+    ++m_stats.skippedOverrun;
+    return false;
+  }
+
+  if (RemainingBudget(now) < m_minimumIdleTime) {
+    ++m_stats.skippedNoBudget;
+    return false;
+  }
+
+  ++m_stats.idleEventsSent;
+  return true;
+}
+
+IdleCallbackScheduler::Duration IdleCallbackScheduler::RemainingBudget(TimePoint now) const noexcept {
+  return std::max(m_frameStart + m_frameInterval - now, Duration::zero());
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace facebook {
+namespace react {
+
+struct IdleCallbackStats {
+  uint64_t frames = 0;
+  uint64_t idleEventsSent = 0;
+  uint64_t skippedNoBudget = 0; // The frame's own work left too little time
+  uint64_t skippedOverrun = 0; // The previous frame ran past its deadline
+};
+
+// Decides in which frames the Timing module lets JS run requestIdleCallback
+// callbacks. The module calls BeginFrame when a frame starts and
+// EndFrameWork once the frame's own work (such as firing timers) is done.
+// Idle callbacks run only while JS asked for them, only with enough of the
+// frame budget left, and never right after a frame that overran, so that
+// deferred work does not compete with rendering. Times are passed in, so
+// tests can drive it with a fake clock.
+class IdleCallbackScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+  using Duration = Clock::duration;
+
+  static constexpr Duration c_defaultFrameInterval = std::chrono::microseconds(16667);
+  // JSTimers does not run idle callbacks with less than 1ms left.
+  static constexpr Duration c_defaultMinimumIdleTime = std::chrono::milliseconds(1);
+
+  IdleCallbackScheduler(
+      Duration frameInterval = c_defaultFrameInterval,
+      Duration minimumIdleTime = c_defaultMinimumIdleTime) noexcept;
+
+  void SetEnabled(bool enabled) noexcept;
+  bool IsEnabled() const noexcept {
+    return m_enabled;
+  }
+
+  void BeginFrame(TimePoint frameStart) noexcept;
+
+  // Returns whether to send callIdleCallbacks for the current frame.
+  bool EndFrameWork(TimePoint now) noexcept;
+
+  TimePoint FrameStart() const noexcept {
+    return m_frameStart;
+  }
+
+  // Time left until the current frame's deadline, never negative.
+  Duration RemainingBudget(TimePoint now) const noexcept;
+
+  IdleCallbackStats GetStats() const noexcept {
+    return m_stats;
+  }
+
+ private:
+  Duration m_frameInterval;
+  Duration m_minimumIdleTime;
+  bool m_enabled{false};
+  bool m_inFrame{false};
+  bool m_hasPreviousFrame{false};
+  bool m_previousFrameOverran{false};
+  TimePoint m_frameStart{};
+  TimePoint m_workDone{};
+  IdleCallbackStats m_stats;
+};
+
+} // namespace react
+} // namespace facebook
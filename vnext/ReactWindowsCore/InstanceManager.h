@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "DevSettings.h"
+#include "EventCoalescingQueue.h"
 #include "IReactRootView.h"
 
 namespace folly {
@@ -34,6 +35,7 @@ struct InstanceWrapper {
   virtual void DetachRootView(IReactRootView *rootView) noexcept = 0;
 
   virtual void DispatchEvent(int64_t viewTag, std::string eventName, folly::dynamic &&eventData) = 0;
+  virtual EventCoalescingStats GetEventCoalescingStats() const = 0;
   virtual void invokeCallback(const int64_t callbackId, folly::dynamic &&params) = 0;
   virtual void loadBundle(std::string &&jsBundleRelativePath) = 0;
   virtual void loadBundleSync(std::string &&jsBundleRelativePath) = 0;
@@ -92,13 +92,131 @@ void UIManager::DropView(int64_t tag, bool removeChildren /*= true*/, bool zombi
   for (auto childTag : node.m_children)
     DropView(childTag, removeChildren, zombieView);
 
-  if (removeChildren)
+  if (removeChildren && !node.m_layoutOnly)
     node.removeAllChildren();
 
+  if (node.m_layoutOnly && !zombieView)
+    --m_layoutOnlyViewStats.flattenedViews;
+
   if (!zombieView)
     m_nodeRegistry.removeNode(tag);
 }
 
+// Number of native views |node| contributes to its nearest native ancestor.
+size_t UIManager::NativeViewCount(ShadowNode &node) {
+  if (!node.m_layoutOnly)
+    return 1;
+
+  size_t count = 0;
+  for (auto childTag : node.m_children)
+    count += NativeViewCount(m_nodeRegistry.getNode(childTag));
+  return count;
+}
+
+// Finds the node whose native view hosts the child at |index| of |parent|, and
+// the index of that child among the native children. Returns nullptr if
+// |parent| is a layout-only node that is not attached yet.
+ShadowNode *UIManager::ResolveNativeParent(ShadowNode &parent, int64_t index, int64_t &nativeIndex) {
+  ShadowNode *current = &parent;
+  int64_t offset = 0;
+  for (int64_t i = 0; i < index; ++i)
+    offset += NativeViewCount(m_nodeRegistry.getNode(parent.m_children[static_cast<size_t>(i)]));
+
+  while (current->m_layoutOnly) {
+    if (current->m_parent == -1)
+      return nullptr;
+
+    auto &grandParent = m_nodeRegistry.getNode(current->m_parent);
+    for (auto siblingTag : grandParent.m_children) {
+      if (siblingTag == current->m_tag)
+        break;
+      offset += NativeViewCount(m_nodeRegistry.getNode(siblingTag));
+    }
+    current = &grandParent;
+  }
+
+  nativeIndex = offset;
+  return current;
+}
+
+void UIManager::MountNativeViews(ShadowNode &nativeParent, ShadowNode &node, int64_t &nativeIndex) {
+  if (!node.m_layoutOnly) {
+    nativeParent.AddView(node, nativeIndex++);
+    return;
+  }
+
+  for (auto childTag : node.m_children)
+    MountNativeViews(nativeParent, m_nodeRegistry.getNode(childTag), nativeIndex);
+}
+
+// Expects |child| to already be at |index| in parent.m_children.
+void UIManager::AddNativeChild(ShadowNode &parent, ShadowNode &child, int64_t index) {
+  int64_t nativeIndex = 0;
+  ShadowNode *nativeParent = ResolveNativeParent(parent, index, nativeIndex);
+  if (nativeParent == nullptr || nativeParent->m_zombie)
+    return;
+
+  if (child.m_layoutOnly && !m_nativeUIManager->canHostLayoutOnlyChildren(*nativeParent))
+    CreateNativeViewForLayoutOnlyNode(child);
+
+  MountNativeViews(*nativeParent, child, nativeIndex);
+}
+
+// Expects |child| to still be at |index| in parent.m_children.
+void UIManager::RemoveNativeChild(ShadowNode &parent, ShadowNode &child, int64_t index) {
+  int64_t nativeIndex = 0;
+  ShadowNode *nativeParent = ResolveNativeParent(parent, index, nativeIndex);
+  if (nativeParent == nullptr)
+    return;
+
+  for (size_t count = NativeViewCount(child); count > 0; --count)
+    nativeParent->RemoveChildAt(nativeIndex);
+}
+
+// Gives a layout-only node a native view and mounts its children into it.
+void UIManager::CreateNativeViewForLayoutOnlyNode(ShadowNode &node) {
+  node.m_layoutOnly = false;
+  node.createView();
+  --m_layoutOnlyViewStats.flattenedViews;
+  ++m_layoutOnlyViewStats.promotedViews;
+
+  int64_t childIndex = 0;
+  for (auto childTag : node.m_children)
+    MountNativeViews(node, m_nodeRegistry.getNode(childTag), childIndex);
+
+  m_nativeUIManager->OnLayoutOnlyViewPromoted(node);
+}
+
+// Moves the flattened descendants of a mounted layout-only node from the
+// nearest native ancestor into a new native view for the node.
+void UIManager::PromoteLayoutOnlyNode(ShadowNode &node) {
+  if (!node.m_layoutOnly)
+    return;
+
+  ShadowNode *parent = m_nodeRegistry.findNode(node.m_parent);
+  int64_t index = 0;
+  if (parent != nullptr) {
+    auto it = find(parent->m_children.begin(), parent->m_children.end(), node.m_tag);
+    index = it - parent->m_children.begin();
+    RemoveNativeChild(*parent, node, index);
+  }
+
+  CreateNativeViewForLayoutOnlyNode(node);
+
+  if (parent != nullptr)
+    AddNativeChild(*parent, node, index);
+}
+
+ShadowNode &UIManager::EnsureNativeView(int64_t tag) {
+  auto &node = m_nodeRegistry.getNode(tag);
+  PromoteLayoutOnlyNode(node);
+  return node;
+}
+
+LayoutOnlyViewStats UIManager::getLayoutOnlyViewStats() {
+  return m_layoutOnlyViewStats;
+}
+
 void UIManager::removeSubviewsFromContainerWithID(int64_t containerTag) {
   m_nativeUIManager->ensureInBatch();
   auto &containerNode = m_nodeRegistry.getNode(containerTag);
@@ -213,9 +331,9 @@ void UIManager::manageChildren(
     auto viewAtIndex = viewsToRemove[i];
     auto &shadowNodeToRemove = m_nodeRegistry.getNode(viewAtIndex->tag);
 
+    RemoveNativeChild(shadowNodeToManage, shadowNodeToRemove, viewAtIndex->index);
     shadowNodeToManage.m_children.erase(
         shadowNodeToManage.m_children.begin() + static_cast<size_t>(viewAtIndex->index));
-    shadowNodeToManage.RemoveChildAt(viewAtIndex->index);
   }
 
   for (size_t i = 0; i < viewsToAdd.size(); ++i) {
@@ -224,8 +342,7 @@ void UIManager::manageChildren(
     shadowNodeToAdd.m_parent = shadowNodeToManage.m_tag;
     shadowNodeToManage.m_children.insert(
         shadowNodeToManage.m_children.begin() + static_cast<size_t>(viewAtIndex->index), shadowNodeToAdd.m_tag);
-    if (!shadowNodeToManage.m_zombie)
-      shadowNodeToManage.AddView(shadowNodeToAdd, viewAtIndex->index);
+    AddNativeChild(shadowNodeToManage, shadowNodeToAdd, viewAtIndex->index);
 
     m_nativeUIManager->AddView(shadowNodeToManage, shadowNodeToAdd, viewAtIndex->index);
   }
@@ -252,13 +369,18 @@ void UIManager::createView(
   node->m_className = std::move(className);
   node->m_tag = tag;
   node->m_viewManager = viewManager;
+  node->m_layoutOnly = m_nativeUIManager->isLayoutOnlyView(node->m_className, props);
 
-  node->createView();
+  if (node->m_layoutOnly)
+    ++m_layoutOnlyViewStats.flattenedViews;
+  else
+    node->createView();
   m_nativeUIManager->CreateView(*node, props);
 
   m_nodeRegistry.addNode(shadow_ptr(node), tag);
 
-  if (!props.isNull())
+  // Layout-only nodes only carry props the NativeUIManager applies to Yoga.
+  if (!props.isNull() && !node->m_layoutOnly)
     node->updateProperties(std::move(props));
 }
 
@@ -271,8 +393,7 @@ void UIManager::setChildren(int64_t viewTag, folly::dynamic &&childrenTags) {
     auto &childNode = m_nodeRegistry.getNode(tag);
     childNode.m_parent = parent.m_tag;
     parent.m_children.push_back(tag);
-    if (!parent.m_zombie)
-      parent.AddView(childNode, index);
+    AddNativeChild(parent, childNode, index);
 
     m_nativeUIManager->AddView(parent, childNode, index);
 
@@ -287,7 +408,10 @@ void UIManager::updateView(int64_t tag, const std::string &className, folly::dyn
   if (pShadowNode == nullptr)
     return;
 
-  if (!pShadowNode->m_zombie)
+  if (pShadowNode->m_layoutOnly && !m_nativeUIManager->isLayoutOnlyView(pShadowNode->m_className, props))
+    PromoteLayoutOnlyNode(*pShadowNode);
+
+  if (!pShadowNode->m_layoutOnly && !pShadowNode->m_zombie)
     pShadowNode->updateProperties(std::move(props));
 
   m_nativeUIManager->UpdateView(*pShadowNode, props);
@@ -322,13 +446,13 @@ void UIManager::replaceExistingNonRootView(int64_t oldTag, int64_t newTag) {
 
 void UIManager::dispatchViewManagerCommand(int64_t reactTag, int64_t commandId, folly::dynamic &&commandArgs) {
   m_nativeUIManager->ensureInBatch();
-  auto &node = m_nodeRegistry.getNode(reactTag);
+  auto &node = EnsureNativeView(reactTag);
   if (!node.m_zombie)
     node.dispatchCommand(commandId, std::move(commandArgs));
 }
 
 void UIManager::measure(int64_t reactTag, facebook::xplat::module::CxxModule::Callback callback) {
-  auto &node = m_nodeRegistry.getNode(reactTag);
+  auto &node = EnsureNativeView(reactTag);
   int64_t rootTag = reactTag;
   while (true) {
     auto &currNode = m_nodeRegistry.getNode(rootTag);
@@ -342,7 +466,7 @@ void UIManager::measure(int64_t reactTag, facebook::xplat::module::CxxModule::Ca
 }
 
 void UIManager::measureInWindow(int64_t reactTag, facebook::xplat::module::CxxModule::Callback callback) {
-  auto &node = m_nodeRegistry.getNode(reactTag);
+  auto &node = EnsureNativeView(reactTag);
   m_nativeUIManager->measureInWindow(node, callback);
 }
 
@@ -351,8 +475,8 @@ void UIManager::measureLayout(
     int64_t ancestorReactTag,
     facebook::xplat::module::CxxModule::Callback errorCallback,
     facebook::xplat::module::CxxModule::Callback callback) {
-  auto &node = m_nodeRegistry.getNode(reactTag);
-  auto &ancestorNode = m_nodeRegistry.getNode(ancestorReactTag);
+  auto &node = EnsureNativeView(reactTag);
+  auto &ancestorNode = EnsureNativeView(ancestorReactTag);
   m_nativeUIManager->measureLayout(node, ancestorNode, errorCallback, callback);
 };
 
@@ -360,7 +484,7 @@ void UIManager::findSubviewIn(
     int64_t reactTag,
     folly::dynamic &&coordinates,
     facebook::xplat::module::CxxModule::Callback callback) {
-  auto &node = m_nodeRegistry.getNode(reactTag);
+  auto &node = EnsureNativeView(reactTag);
   float x = static_cast<float>(jsArgAsDouble(coordinates, 0));
   float y = static_cast<float>(jsArgAsDouble(coordinates, 1));
   m_nativeUIManager->findSubviewIn(node, x, y, callback);
@@ -371,10 +495,12 @@ void UIManager::onBatchComplete() {
 }
 
 void UIManager::focus(int64_t reactTag) {
+  EnsureNativeView(reactTag);
   m_nativeUIManager->focus(reactTag);
 }
 
 void UIManager::blur(int64_t reactTag) {
+  EnsureNativeView(reactTag);
   m_nativeUIManager->blur(reactTag);
 }
 
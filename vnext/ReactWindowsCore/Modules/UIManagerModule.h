@@ -60,6 +60,7 @@ class UIManager : public IUIManager, INativeUIManagerHost {
   INativeUIManager *getNativeUIManager() override {
     return m_nativeUIManager;
   }
+  LayoutOnlyViewStats getLayoutOnlyViewStats() override;
 
   void focus(int64_t reactTag) override;
   void blur(int64_t reactTag) override;
@@ -86,6 +87,18 @@ class UIManager : public IUIManager, INativeUIManagerHost {
   void DropView(int64_t tag, bool removeChildren = true, bool zombieView = false);
   IViewManager *GetViewManager(const std::string &className) const;
 
+  // Layout-only view flattening
+  size_t NativeViewCount(ShadowNode &node);
+  ShadowNode *ResolveNativeParent(ShadowNode &parent, int64_t index, int64_t &nativeIndex);
+  void MountNativeViews(ShadowNode &nativeParent, ShadowNode &node, int64_t &nativeIndex);
+  void AddNativeChild(ShadowNode &parent, ShadowNode &child, int64_t index);
+  void RemoveNativeChild(ShadowNode &parent, ShadowNode &child, int64_t index);
+  void CreateNativeViewForLayoutOnlyNode(ShadowNode &node);
+  void PromoteLayoutOnlyNode(ShadowNode &node);
+  ShadowNode &EnsureNativeView(int64_t tag);
+
+  LayoutOnlyViewStats m_layoutOnlyViewStats;
+
   int64_t m_nextRootTag = 101;
   static const int64_t RootViewTagIncrement = 10;
 };
@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+// Recycles the storage of objects that are created and destroyed at a high
+// rate, such as the task nodes of a message queue. Create and Destroy are
+// lock-free and may be called from any thread; the free list is a stack of
+// cell indices tagged with a generation count, so a cell that is popped and
+// pushed again while another thread is popping is detected.
+//
+// Cells come in slabs that are kept until the pool is destroyed. Once
+// maxCells cells are in use, rounded up to whole slabs, further objects are
+// allocated on the heap; with maxCells of 0 the pool only forwards to the
+// heap. Every object must be destroyed before the pool.
+template <typename T>
+class NodePool {
+ public:
+  static constexpr size_t c_cellsPerSlab = 256;
+  static constexpr size_t c_maxSlabs = 1024;
+
+  explicit NodePool(size_t maxCells = c_cellsPerSlab * c_maxSlabs) noexcept
+      : m_maxSlabs(std::min((maxCells + c_cellsPerSlab - 1) / c_cellsPerSlab, c_maxSlabs)) {}
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+
+  template <typename... TArgs>
+  T *Create(TArgs &&... args) {
+    Cell *cell = PopFree();
+    if (!cell)
+      cell = new Cell{};
+
+    try {
+      return new (&cell->storage) T(std::forward<TArgs>(args)...);
+    } catch (...) {
+      Recycle(cell);
+      throw;
+    }
+  }
+
+  void Destroy(T *object) noexcept {
+    object->~T();
+    Recycle(reinterpret_cast<Cell *>(object));
+  }
+
+  // Number of objects that did not fit in the slabs.
+  size_t HeapAllocations() const noexcept {
+    return m_heapAllocations.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr uint32_t c_heapIndex = ~uint32_t{0};
+
+  struct Cell {
+    // First, so that a T * is also the address of its cell.
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    std::atomic<uint32_t> next{0};
+    uint32_t index{c_heapIndex}; // 1-based; 0 ends the free list
+  };
+
+  // The head of the free list: generation in the high half, index in the
+  // low half.
+  static uint64_t Pack(uint64_t head, uint32_t index) noexcept {
+    return (((head >> 32) + 1) << 32) | index;
+  }
+
+  static uint32_t IndexOf(uint64_t head) noexcept {
+    return static_cast<uint32_t>(head);
+  }
+
+  Cell &CellAt(uint32_t index) noexcept {
+    return m_slabs[(index - 1) / c_cellsPerSlab][(index - 1) % c_cellsPerSlab];
+  }
+
+  Cell *PopFree() {
+    uint64_t head = m_freeHead.load(std::memory_order_acquire);
+    while (true) {
+      if (IndexOf(head) == 0) {
+        // Once full, the pool stays full: skip the lock.
+        if (m_slabCount.load(std::memory_order_relaxed) == m_maxSlabs || !Grow()) {
+          m_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        head = m_freeHead.load(std::memory_order_acquire);
+        continue;
+      }
+
+      Cell &cell = CellAt(IndexOf(head));
+      const uint32_t next = cell.next.load(std::memory_order_relaxed);
+      if (m_freeHead.compare_exchange_weak(
+              head, Pack(head, next), std::memory_order_acquire, std::memory_order_acquire))
+        return &cell;
+    }
+  }
+
+  void Recycle(Cell *cell) noexcept {
+    if (cell->index == c_heapIndex) {
+      delete cell;
+      return;
+    }
+    PushFree(*cell, *cell);
+  }
+
+  // Pushes the chain first..last, already linked through next.
+  void PushFree(Cell &first, Cell &last) noexcept {
+    uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+    do {
+      last.next.store(IndexOf(head), std::memory_order_relaxed);
+    } while (!m_freeHead.compare_exchange_weak(
+        head, Pack(head, first.index), std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Adds a slab to the free list. Returns false when out of slabs.
+  bool Grow() {
+    std::lock_guard<std::mutex> lock(m_growMutex);
+    if (IndexOf(m_freeHead.load(std::memory_order_acquire)) != 0)
+      return true; // Another thread grew the pool or a cell came back.
+    const size_t slabCount = m_slabCount.load(std::memory_order_relaxed);
+    if (slabCount == m_maxSlabs)
+      return false;
+
+    auto slab = std::make_unique<Cell[]>(c_cellsPerSlab);
+    for (size_t i = 0; i < c_cellsPerSlab; ++i) {
+      slab[i].index = static_cast<uint32_t>(slabCount * c_cellsPerSlab + i + 1);
+      if (i + 1 < c_cellsPerSlab)
+        slab[i].next.store(slab[i].index + 1, std::memory_order_relaxed);
+    }
+
+    // The slab is published by the release in PushFree.
+    Cell &first = slab[0];
+    Cell &last = slab[c_cellsPerSlab - 1];
+    m_slabs[slabCount] = std::move(slab);
+    m_slabCount.store(slabCount + 1, std::memory_order_relaxed);
+    PushFree(first, last);
+    return true;
+  }
+
+  std::atomic<uint64_t> m_freeHead{0};
+  std::atomic<size_t> m_heapAllocations{0};
+
+  std::mutex m_growMutex;
+  const size_t m_maxSlabs;
+  std::atomic<size_t> m_slabCount{0};
+  std::array<std::unique_ptr<Cell[]>, c_maxSlabs> m_slabs;
+};
+
+} // namespace react
+} // namespace facebook
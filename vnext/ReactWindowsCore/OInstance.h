@@ -83,6 +83,7 @@ class InstanceImpl : public InstanceWrapper, private ::std::enable_shared_from_t
   void DetachRootView(IReactRootView *rootView) noexcept override;
 
   void DispatchEvent(int64_t viewTag, std::string eventName, folly::dynamic &&eventData) override;
+  EventCoalescingStats GetEventCoalescingStats() const override;
   void invokeCallback(const int64_t callbackId, folly::dynamic &&params) override;
 
   ~InstanceImpl();
@@ -149,6 +150,7 @@ class InstanceImpl : public InstanceWrapper, private ::std::enable_shared_from_t
 
   std::shared_ptr<IDevSupportManager> m_devManager;
   std::shared_ptr<DevSettings> m_devSettings;
+  std::shared_ptr<EventCoalescingQueue> m_eventQueue{std::make_shared<EventCoalescingQueue>()};
 };
 
 } // namespace react
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/MessageQueueThread.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+enum class TaskPriority : uint8_t {
+  UserBlocking, // Input and anything the user waits on
+  Normal, // runOnQueue
+  Background, // Logging, analytics
+};
+
+constexpr size_t c_taskPriorityCount = 3;
+
+// Implemented by the MessageQueueThreads that can run some tasks ahead of
+// others. Tasks posted with runOnQueue have Normal priority, so callers that
+// do not opt in keep FIFO order among themselves.
+struct IPriorityMessageQueue {
+  virtual ~IPriorityMessageQueue() = default;
+  virtual void runOnQueueWithPriority(TaskPriority priority, std::function<void()> &&func) = 0;
+};
+
+// Posts func with the priority if the queue supports it, and with
+// runOnQueue otherwise.
+inline void RunOnQueueWithPriority(MessageQueueThread &queue, TaskPriority priority, std::function<void()> &&func) {
+  if (auto priorityQueue = dynamic_cast<IPriorityMessageQueue *>(&queue))
+    priorityQueue->runOnQueueWithPriority(priority, std::move(func));
+  else
+    queue.runOnQueue(std::move(func));
+}
+
+// A FIFO lane for TaskLanes that are reused: it keeps its storage when it
+// runs empty, so a warm lane does not allocate.
+template <typename TTask>
+class RecycledLane {
+ public:
+  void push_back(TTask &&task) {
+    m_tasks.push_back(std::move(task));
+  }
+
+  TTask &front() noexcept {
+    return m_tasks[m_head];
+  }
+
+  // The popped task stays moved-from in the storage until the lane runs
+  // empty.
+  void pop_front() noexcept {
+    if (++m_head == m_tasks.size())
+      clear();
+  }
+
+  bool empty() const noexcept {
+    return m_head == m_tasks.size();
+  }
+
+  size_t size() const noexcept {
+    return m_tasks.size() - m_head;
+  }
+
+  void clear() noexcept {
+    m_tasks.clear();
+    m_head = 0;
+  }
+
+ private:
+  std::vector<TTask> m_tasks;
+  size_t m_head{0};
+};
+
+// The pending tasks of a queue, one FIFO lane per priority. Pop takes from
+// the most urgent lane, except that a lane that has been passed over its
+// budget of times in a row while it had tasks gets the next turn, so a
+// steady stream of urgent work cannot starve the other lanes. Not
+// thread-safe; the owner locks.
+template <typename TTask, typename TLane = std::deque<TTask>>
+class TaskLanes {
+ public:
+  // Times a lane may be passed over before it gets a turn.
+  static constexpr std::array<uint32_t, c_taskPriorityCount> c_bypassBudgets{{0, 4, 16}};
+
+  void Push(TaskPriority priority, TTask &&task) {
+    m_lanes[static_cast<size_t>(priority)].push_back(std::move(task));
+    ++m_size;
+  }
+
+  TTask Pop() {
+    assert(m_size != 0);
+
+    size_t lane = 0;
+    while (m_lanes[lane].empty())
+      ++lane;
+    for (size_t starved = c_taskPriorityCount; starved-- > lane + 1;) {
+      if (!m_lanes[starved].empty() && m_bypassed[starved] >= c_bypassBudgets[starved]) {
+        lane = starved;
+        break;
+      }
+    }
+
+    m_bypassed[lane] = 0;
+    for (size_t lower = lane + 1; lower < c_taskPriorityCount; ++lower) {
+      if (!m_lanes[lower].empty())
+        ++m_bypassed[lower];
+    }
+
+    TTask task = std::move(m_lanes[lane].front());
+    m_lanes[lane].pop_front();
+    --m_size;
+    return task;
+  }
+
+  bool IsEmpty() const noexcept {
+    return m_size == 0;
+  }
+
+  size_t Size() const noexcept {
+    return m_size;
+  }
+
+  size_t Size(TaskPriority priority) const noexcept {
+    return m_lanes[static_cast<size_t>(priority)].size();
+  }
+
+  // The most urgent priority with pending tasks. The lanes must not be
+  // empty.
+  TaskPriority HighestPriority() const noexcept {
+    assert(m_size != 0);
+    size_t lane = 0;
+    while (m_lanes[lane].empty())
+      ++lane;
+    return static_cast<TaskPriority>(lane);
+  }
+
+  void Clear() {
+    for (auto &lane : m_lanes)
+      lane.clear();
+    m_bypassed.fill(0);
+    m_size = 0;
+  }
+
+ private:
+  std::array<TLane, c_taskPriorityCount> m_lanes;
+  std::array<uint32_t, c_taskPriorityCount> m_bypassed{};
+  size_t m_size{0};
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "QueueStats.h"
+#include "Tracing.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr const char *c_longTaskSectionName = "QueueLongTask";
+
+uint64_t ToMicroseconds(std::chrono::nanoseconds duration) noexcept {
+  return static_cast<uint64_t>(
+      std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0));
+}
+
+} // namespace
+
+void AtomicLog2Histogram::Add(uint64_t value) noexcept {
+  // Same buckets as Log2Histogram::Add: bucket i holds [2^(i-1), 2^i).
+  size_t bucket = 0;
+  while (bucket < Log2Histogram::c_bucketCount - 1 && (value >> bucket) != 0)
+    ++bucket;
+
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(value, std::memory_order_relaxed);
+
+  uint64_t max = m_max.load(std::memory_order_relaxed);
+  while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+Log2Histogram AtomicLog2Histogram::GetSnapshot() const noexcept {
+  Log2Histogram snapshot;
+  for (size_t i = 0; i < Log2Histogram::c_bucketCount; ++i)
+    snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+  snapshot.count = m_count.load(std::memory_order_relaxed);
+  snapshot.sum = static_cast<double>(m_sum.load(std::memory_order_relaxed));
+  snapshot.max = static_cast<double>(m_max.load(std::memory_order_relaxed));
+  return snapshot;
+}
+
+void AtomicLog2Histogram::Reset() noexcept {
+  for (auto &bucket : m_buckets)
+    bucket.store(0, std::memory_order_relaxed);
+  m_count.store(0, std::memory_order_relaxed);
+  m_sum.store(0, std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+QueueStats::QueueStats(std::string name, std::chrono::nanoseconds longTaskBudget) noexcept
+    : m_name{std::move(name)}, m_longTaskBudget{longTaskBudget} {}
+
+const std::string &QueueStats::Name() const noexcept {
+  return m_name;
+}
+
+std::chrono::nanoseconds QueueStats::LongTaskBudget() const noexcept {
+  return m_longTaskBudget;
+}
+
+void QueueStats::RecordPost() noexcept {
+  const int64_t depth = m_pending.fetch_add(1, std::memory_order_relaxed) + 1;
+  m_posted.fetch_add(1, std::memory_order_relaxed);
+  m_depth.Add(static_cast<uint64_t>(std::max<int64_t>(depth, 1)));
+}
+
+void QueueStats::RecordTask(std::chrono::nanoseconds wait, std::chrono::nanoseconds run) noexcept {
+  m_pending.fetch_sub(1, std::memory_order_relaxed);
+  m_ran.fetch_add(1, std::memory_order_relaxed);
+  m_waitUs.Add(ToMicroseconds(wait));
+  m_runUs.Add(ToMicroseconds(run));
+
+  if (run > m_longTaskBudget) {
+    m_longTasks.fetch_add(1, std::memory_order_relaxed);
+    if (!IsTracingEnabled())
+      return;
+
+    // The task already returned, so the section is reported with its duration.
+    const std::string args =
+        "queue=" + m_name + " waitUs=" + std::to_string(ToMicroseconds(wait)) + " runUs=" +
+        std::to_string(ToMicroseconds(run));
+    SystraceBeginSection(c_longTaskSectionName, args.c_str());
+    SystraceEndSection(c_longTaskSectionName, args.c_str(), run);
+  }
+}
+
+void QueueStats::RecordCancel() noexcept {
+  m_pending.fetch_sub(1, std::memory_order_relaxed);
+  m_canceled.fetch_add(1, std::memory_order_relaxed);
+}
+
+QueueStatsSnapshot QueueStats::GetSnapshot() const noexcept {
+  QueueStatsSnapshot snapshot;
+  snapshot.posted = m_posted.load(std::memory_order_relaxed);
+  snapshot.ran = m_ran.load(std::memory_order_relaxed);
+  snapshot.canceled = m_canceled.load(std::memory_order_relaxed);
+  snapshot.longTasks = m_longTasks.load(std::memory_order_relaxed);
+  snapshot.waitUs = m_waitUs.GetSnapshot();
+  snapshot.runUs = m_runUs.GetSnapshot();
+  snapshot.depth = m_depth.GetSnapshot();
+  return snapshot;
+}
+
+void QueueStats::Reset() noexcept {
+  m_posted.store(0, std::memory_order_relaxed);
+  m_ran.store(0, std::memory_order_relaxed);
+  m_canceled.store(0, std::memory_order_relaxed);
+  m_longTasks.store(0, std::memory_order_relaxed);
+  m_waitUs.Reset();
+  m_runUs.Reset();
+  m_depth.Reset();
+}
+
+std::function<void()> MakeMeasuredTask(const std::shared_ptr<QueueStats> &stats, std::function<void()> &&func) {
+  stats->RecordPost();
+  return [stats, func = std::move(func), posted = std::chrono::steady_clock::now()]() {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    stats->RecordTask(start - posted, std::chrono::steady_clock::now() - start);
+  };
+}
+
+} // namespace react
+} // namespace facebook
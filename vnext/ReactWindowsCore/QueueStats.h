@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "Animated/AnimationStats.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+// Log2Histogram whose values can be added from any thread without a lock.
+// A snapshot taken while values are added may miss some of them.
+class AtomicLog2Histogram {
+ public:
+  void Add(uint64_t value) noexcept;
+  Log2Histogram GetSnapshot() const noexcept;
+  void Reset() noexcept;
+
+ private:
+  std::array<std::atomic<uint64_t>, Log2Histogram::c_bucketCount> m_buckets{};
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<uint64_t> m_sum{0};
+  std::atomic<uint64_t> m_max{0};
+};
+
+struct QueueStatsSnapshot {
+  uint64_t posted{0};
+  uint64_t ran{0};
+  uint64_t canceled{0};
+  uint64_t longTasks{0};
+
+  // From the post to the task starting, in microseconds. The last bucket
+  // holds everything above 16ms, i.e. a frame.
+  Log2Histogram waitUs;
+  // From the task starting to it returning, in microseconds.
+  Log2Histogram runUs;
+  // Tasks waiting in the queue when a task is posted, including it.
+  Log2Histogram depth;
+};
+
+// Records how long tasks wait in a queue before they start, how long they
+// run, and how deep the queue is. Queues take an optional
+// shared_ptr<QueueStats>; without one they do not read the clock at all.
+//
+// Tasks running longer than the budget are counted as long tasks and
+// reported as a QueueLongTask section on the INativeTraceHandler once they
+// returned.
+class QueueStats {
+ public:
+  explicit QueueStats(
+      std::string name,
+      std::chrono::nanoseconds longTaskBudget = std::chrono::milliseconds(16)) noexcept;
+
+  const std::string &Name() const noexcept;
+  std::chrono::nanoseconds LongTaskBudget() const noexcept;
+
+  // A task was added to the queue.
+  void RecordPost() noexcept;
+  // A posted task ran.
+  void RecordTask(std::chrono::nanoseconds wait, std::chrono::nanoseconds run) noexcept;
+  // A posted task was dropped without running.
+  void RecordCancel() noexcept;
+
+  QueueStatsSnapshot GetSnapshot() const noexcept;
+  void Reset() noexcept;
+
+ private:
+  const std::string m_name;
+  const std::chrono::nanoseconds m_longTaskBudget;
+
+  // Posted tasks that did not run or get canceled yet.
+  std::atomic<int64_t> m_pending{0};
+  std::atomic<uint64_t> m_posted{0};
+  std::atomic<uint64_t> m_ran{0};
+  std::atomic<uint64_t> m_canceled{0};
+  std::atomic<uint64_t> m_longTasks{0};
+  AtomicLog2Histogram m_waitUs;
+  AtomicLog2Histogram m_runUs;
+  AtomicLog2Histogram m_depth;
+};
+
+// Records the post of func and returns a function that records its wait
+// and run times when called. For queues that cannot keep the post time
+// next to their tasks.
+std::function<void()> MakeMeasuredTask(const std::shared_ptr<QueueStats> &stats, std::function<void()> &&func);
+
+} // namespace react
+} // namespace facebook
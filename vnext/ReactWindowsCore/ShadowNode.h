@@ -32,6 +32,10 @@ struct ShadowNode {
   int64_t m_parent = -1;
   IViewManager *m_viewManager = nullptr;
   bool m_zombie = false;
+
+  // A layout-only node has a Yoga node but no native view; its children are
+  // mounted into the nearest ancestor that has one.
+  bool m_layoutOnly = false;
 };
 
 } // namespace react
@@ -0,0 +1,256 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+struct TimerHeapStats {
+  uint64_t batches = 0; // PopExpired calls that fired at least one timer
+  uint64_t timersFired = 0;
+  // Distinct due times fired together beyond the first in each batch. This
+  // counts merged due times, not wakeups: without slack the owner may still
+  // have fired some of them together, or woken up for other work anyway.
+  uint64_t mergedDueTimes = 0;
+};
+
+// Where a Timing module publishes its TimerHeapStats for the host. Written
+// on the module's queue after each batch, read from any thread.
+class TimerStats {
+ public:
+  void Publish(const TimerHeapStats &stats) noexcept {
+    m_batches.store(stats.batches, std::memory_order_relaxed);
+    m_timersFired.store(stats.timersFired, std::memory_order_relaxed);
+    m_mergedDueTimes.store(stats.mergedDueTimes, std::memory_order_relaxed);
+  }
+
+  TimerHeapStats Get() const noexcept {
+    TimerHeapStats stats;
+    stats.batches = m_batches.load(std::memory_order_relaxed);
+    stats.timersFired = m_timersFired.load(std::memory_order_relaxed);
+    stats.mergedDueTimes = m_mergedDueTimes.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  std::atomic<uint64_t> m_batches{0};
+  std::atomic<uint64_t> m_timersFired{0};
+  std::atomic<uint64_t> m_mergedDueTimes{0};
+};
+
+// The JS timers of a Timing module, ordered by due time. An indexed binary
+// min-heap: pushing, popping and removing a timer by id are O(log n). Timers
+// that are due at the same time come out in the order they were pushed.
+// TimePoint is the clock's time_point type, so both the UWP and the Desktop
+// module can use their own clock.
+//
+// A timer may fire up to Slack after its due time. The owner waits until
+// NextDeadline and then fires everything that is due, so timers due close
+// together are handed to JS in one callTimers batch. The deadlines are kept
+// in a second ordered set, so NextDeadline is O(1).
+template <typename TTimePoint>
+class TimerHeap {
+ public:
+  using TimePoint = TTimePoint;
+  using Duration = typename TTimePoint::duration;
+
+  struct Timer {
+    int64_t Id;
+    TimePoint DueTime;
+    Duration Period;
+    bool Repeat;
+    Duration Slack{};
+  };
+
+  // Adds the timer. A queued timer with the same id is replaced.
+  void Push(const Timer &timer) {
+    const auto found = m_positions.find(timer.Id);
+    if (found != m_positions.end()) {
+      const size_t position = found->second;
+      m_deadlines.erase(DeadlineOf(m_heap[position].timer));
+      m_deadlines.insert(DeadlineOf(timer));
+      m_heap[position] = Entry{timer, m_nextSequence++};
+      Restore(position);
+      return;
+    }
+
+    m_deadlines.insert(DeadlineOf(timer));
+    m_heap.push_back(Entry{timer, m_nextSequence++});
+    m_positions.emplace(timer.Id, m_heap.size() - 1);
+    SiftUp(m_heap.size() - 1);
+  }
+
+  const Timer &Front() const {
+    assert(!m_heap.empty());
+    return m_heap.front().timer;
+  }
+
+  void Pop() {
+    assert(!m_heap.empty());
+    RemoveAt(0);
+  }
+
+  // The earliest time at which a timer must fire, the minimum of DueTime +
+  // Slack over all timers.
+  TimePoint NextDeadline() const {
+    assert(!m_deadlines.empty());
+    return m_deadlines.begin()->first;
+  }
+
+  // Removes the timers due at or before fireUntil and returns their ids in
+  // due order. Repeating timers are queued again one period after now.
+  std::vector<int64_t> PopExpired(TimePoint fireUntil, TimePoint now) {
+    std::vector<int64_t> ids;
+    std::vector<Timer> repeating;
+    size_t dueTimes = 0;
+    TimePoint lastDueTime{};
+    while (!m_heap.empty() && m_heap.front().timer.DueTime <= fireUntil) {
+      const Timer timer = m_heap.front().timer;
+      RemoveAt(0);
+
+      ids.push_back(timer.Id);
+      if (dueTimes == 0 || timer.DueTime != lastDueTime) {
+        ++dueTimes;
+        lastDueTime = timer.DueTime;
+      }
+      if (timer.Repeat)
+        repeating.push_back(timer);
+    }
+
+    for (auto &timer : repeating) {
+      timer.DueTime = now + timer.Period;
+      Push(timer);
+    }
+
+    if (!ids.empty()) {
+      ++m_stats.batches;
+      m_stats.timersFired += ids.size();
+      m_stats.mergedDueTimes += dueTimes - 1;
+    }
+    return ids;
+  }
+
+  // Returns false if no timer with the id is queued.
+  bool Remove(int64_t id) {
+    const auto found = m_positions.find(id);
+    if (found == m_positions.end())
+      return false;
+
+    RemoveAt(found->second);
+    return true;
+  }
+
+  bool Contains(int64_t id) const {
+    return m_positions.count(id) != 0;
+  }
+
+  bool IsEmpty() const noexcept {
+    return m_heap.empty();
+  }
+
+  size_t Size() const noexcept {
+    return m_heap.size();
+  }
+
+  void Clear() noexcept {
+    m_heap.clear();
+    m_positions.clear();
+    m_deadlines.clear();
+  }
+
+  TimerHeapStats GetStats() const noexcept {
+    return m_stats;
+  }
+
+ private:
+  struct Entry {
+    Timer timer;
+    uint64_t sequence;
+  };
+
+  // Ids are unique, so a timer's deadline entry is unique too.
+  using Deadline = std::pair<TimePoint, int64_t>;
+
+  static Deadline DeadlineOf(const Timer &timer) {
+    return Deadline{timer.DueTime + timer.Slack, timer.Id};
+  }
+
+  static bool Earlier(const Entry &left, const Entry &right) noexcept {
+    if (left.timer.DueTime != right.timer.DueTime)
+      return left.timer.DueTime < right.timer.DueTime;
+    return left.sequence < right.sequence;
+  }
+
+  void RemoveAt(size_t position) {
+    m_positions.erase(m_heap[position].timer.Id);
+    m_deadlines.erase(DeadlineOf(m_heap[position].timer));
+
+    const size_t last = m_heap.size() - 1;
+    if (position != last) {
+      m_heap[position] = std::move(m_heap[last]);
+      m_positions[m_heap[position].timer.Id] = position;
+    }
+    m_heap.pop_back();
+
+    if (position < m_heap.size())
+      Restore(position);
+  }
+
+  void Restore(size_t position) {
+    if (position > 0 && Earlier(m_heap[position], m_heap[(position - 1) / 2]))
+      SiftUp(position);
+    else
+      SiftDown(position);
+  }
+
+  void SiftUp(size_t position) {
+    while (position > 0) {
+      const size_t parent = (position - 1) / 2;
+      if (!Earlier(m_heap[position], m_heap[parent]))
+        break;
+      Swap(position, parent);
+      position = parent;
+    }
+  }
+
+  void SiftDown(size_t position) {
+    const size_t size = m_heap.size();
+    while (true) {
+      const size_t left = 2 * position + 1;
+      if (left >= size)
+        break;
+
+      const size_t right = left + 1;
+      const size_t earliest = right < size && Earlier(m_heap[right], m_heap[left]) ? right : left;
+      if (!Earlier(m_heap[earliest], m_heap[position]))
+        break;
+      Swap(position, earliest);
+      position = earliest;
+    }
+  }
+
+  void Swap(size_t first, size_t second) {
+    std::swap(m_heap[first], m_heap[second]);
+    m_positions[m_heap[first].timer.Id] = first;
+    m_positions[m_heap[second].timer.Id] = second;
+  }
+
+  std::vector<Entry> m_heap;
+  std::unordered_map<int64_t, size_t> m_positions;
+  std::set<Deadline> m_deadlines;
+  uint64_t m_nextSequence{0};
+  TimerHeapStats m_stats;
+};
+
+} // namespace react
+} // namespace facebook
@@ -18,9 +18,37 @@ struct INativeTraceHandler {
   virtual void NativeBeginSection(const char *profileName, const char *args) noexcept = 0;
   virtual void
   NativeEndSection(const char *profileName, const char *args, std::chrono::nanoseconds duration) noexcept = 0;
+
+  // Native sections that may overlap and end in another callback than they
+  // began in, matched by cookie. By default they are reported as JS async
+  // sections, without their arguments.
+  virtual void NativeBeginAsyncSection(const char *profileName, int cookie, const char * /*args*/) noexcept {
+    JSBeginAsyncSection(profileName, cookie);
+  }
+  virtual void NativeEndAsyncSection(
+      const char *profileName,
+      int cookie,
+      const char * /*args*/,
+      std::chrono::nanoseconds /*duration*/) noexcept {
+    JSEndAsyncSection(profileName, cookie);
+  }
 };
 
 void InitializeTracing(INativeTraceHandler *handler);
 
+// Whether a handler was passed to InitializeTracing. Callers check it before
+// formatting section arguments.
+bool IsTracingEnabled() noexcept;
+
+// Forward native sections to the handler passed to InitializeTracing, if any.
+void SystraceBeginSection(const char *name, const char *args) noexcept;
+void SystraceEndSection(const char *name, const char *args, std::chrono::nanoseconds duration) noexcept;
+void SystraceBeginAsyncSection(const char *name, int cookie, const char *args) noexcept;
+void SystraceEndAsyncSection(
+    const char *name,
+    int cookie,
+    const char *args,
+    std::chrono::nanoseconds duration) noexcept;
+
 } // namespace react
 } // namespace facebook
@@ -712,6 +712,7 @@ InstanceImpl::InstanceImpl(
 
 InstanceImpl::~InstanceImpl() {
   m_nativeQueue->quitSynchronous();
+  m_eventQueue->Drop();
 }
 
 void InstanceImpl::AttachMeasuredRootView(IReactRootView *rootView, folly::dynamic &&initProps) noexcept {
@@ -766,7 +767,9 @@ std::vector<std::unique_ptr<NativeModule>> InstanceImpl::GetDefaultNativeModules
   modules.push_back(std::make_unique<CxxNativeModule>(
       m_innerInstance,
       "Timing",
-      [nativeQueue]() -> std::unique_ptr<xplat::module::CxxModule> { return react::CreateTimingModule(nativeQueue); },
+      [nativeQueue, devSettings = m_devSettings]() -> std::unique_ptr<xplat::module::CxxModule> {
+        return react::CreateTimingModule(nativeQueue, devSettings->timerSlackMs, devSettings->timerStats);
+      },
       nativeQueue));
 #endif
 
@@ -817,8 +820,37 @@ void InstanceImpl::DispatchEvent(int64_t viewTag, std::string eventName, folly::
     return;
   }
 
-  folly::dynamic params = folly::dynamic::array(viewTag, eventName, std::move(eventData));
-  m_innerInstance->callJSFunction("RCTEventEmitter", "receiveEvent", std::move(params));
+  if (!m_devSettings->enableEventCoalescing) {
+    folly::dynamic params = folly::dynamic::array(viewTag, eventName, std::move(eventData));
+    m_innerInstance->callJSFunction("RCTEventEmitter", "receiveEvent", std::move(params));
+    return;
+  }
+
+  if (!m_eventQueue->Enqueue(viewTag, std::move(eventName), std::move(eventData)))
+    return;
+
+  // Flush on the next turn of the JS queue. Events raised until then are
+  // merged into the pending ones. Each merged event still goes through
+  // callJSFunction, so it gets the bridge's checks and tracing.
+  m_jsThread->runOnQueue([eventQueue = m_eventQueue,
+                          weakInstance = std::weak_ptr<Instance>(m_innerInstance),
+                          devManager = m_devManager]() {
+    auto instance = weakInstance.lock();
+    if (!instance || devManager->HasException()) {
+      eventQueue->Drop();
+      return;
+    }
+
+    eventQueue->Flush([&instance](EventCoalescingQueue::Event &&event) {
+      folly::dynamic params =
+          folly::dynamic::array(event.viewTag, std::move(event.eventName), std::move(event.eventData));
+      instance->callJSFunction("RCTEventEmitter", "receiveEvent", std::move(params));
+    });
+  });
+}
+
+EventCoalescingStats InstanceImpl::GetEventCoalescingStats() const {
+  return m_eventQueue->GetStats();
 }
 
 void InstanceImpl::invokeCallback(const int64_t callbackId, folly::dynamic &&params) {
@@ -15,6 +15,7 @@
 namespace facebook {
 namespace react {
 struct INativeUIManager;
+class QueueStats;
 }
 } // namespace facebook
 
@@ -23,6 +24,7 @@ namespace uwp {
 
 struct IXamlRootView;
 class ExpressionAnimationStore;
+class NativeAnimatedNodeManager;
 
 typedef unsigned int LiveReloadCallbackCookie;
 typedef unsigned int ErrorCallbackCookie;
@@ -43,6 +45,18 @@ struct ReactInstanceSettings {
   bool EnableJITCompilation{true};
   bool EnableByteCodeCaching{false};
   bool EnableDeveloperMenu{false};
+  bool EnableViewFlattening{false};
+  bool EnableHitTestIndex{false};
+  bool EnableEventCoalescing{false};
+  double TimerSlackMs{0};
+
+  // Optional task stats of the instance's queues. Each queue needs its own QueueStats.
+  std::shared_ptr<facebook::react::QueueStats> JSQueueStats;
+  std::shared_ptr<facebook::react::QueueStats> NativeQueueStats;
+  std::shared_ptr<facebook::react::QueueStats> UIQueueStats;
+  // The tasks of the batching UI queue, from their push to their run at the end of the batch.
+  // Only the Microsoft.ReactNative instance records the native and batching UI queues.
+  std::shared_ptr<facebook::react::QueueStats> BatchingUIQueueStats;
 
   std::string ByteCodeFileUri;
   std::string DebugHost;
@@ -108,6 +122,11 @@ struct IReactInstance {
 
   virtual ExpressionAnimationStore &GetExpressionAnimationStore() = 0;
 
+  // Registered by NativeAnimatedModule, so that views can deliver events to
+  // Animated.event drivers directly.
+  virtual void SetNativeAnimatedNodeManager(const std::shared_ptr<NativeAnimatedNodeManager> &manager) = 0;
+  virtual std::shared_ptr<NativeAnimatedNodeManager> GetNativeAnimatedNodeManager() const = 0;
+
   virtual const ReactInstanceSettings &GetReactInstanceSettings() const = 0;
 };
 
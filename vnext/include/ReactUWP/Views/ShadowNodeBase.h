@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <HitTestIndex.h>
 #include <ShadowNode.h>
 #include <XamlView.h>
 
@@ -111,6 +112,8 @@ struct REACTWINDOWS_EXPORT ShadowNodeBase : public facebook::react::ShadowNode {
   bool m_onMouseLeave = false;
   bool m_onMouseMove = false;
 
+  facebook::react::PointerEvents m_pointerEvents = facebook::react::PointerEvents::Auto;
+
   // Support Keyboard
  public:
   void UpdateHandledKeyboardEvents(std::string const &propertyName, folly::dynamic const &value);
@@ -130,6 +130,9 @@ const ReactNativeViewConfig = {
     topMouseLeave: {
       registrationName: 'onMouseLeave',
     },
+    topMouseMove: {
+      registrationName: 'onMouseMove',
+    },
   },
   validAttributes: {
     ...ReactNativeViewViewConfigAndroid.validAttributes,
@@ -368,6 +371,7 @@ const ReactNativeViewConfig = {
     enableFocusRing: true,
     onClick: true,
     onMouseLeave: true,
+    onMouseMove: true,
     acceptsKeyboardFocus: true,
     tabIndex: true,
     // Windows]
@@ -423,6 +423,7 @@ type WindowsViewProps = $ReadOnly<{|
   onBlur?: ?(event: FocusEvent) => mixed,
   onMouseLeave?: ?(event: SyntheticEvent<{}>) => mixed,
   onMouseEnter?: ?(event: SyntheticEvent<{}>) => mixed,
+  onMouseMove?: ?(event: SyntheticEvent<{}>) => mixed,
 |}>;
 // Windows]
 